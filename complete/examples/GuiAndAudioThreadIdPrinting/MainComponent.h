@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_utils/juce_audio_utils.h>
 #include <bit>
+#include "RealtimeLogger.h"
 
 class GuiAndAudioThreadIdPrinting : public juce::AudioAppComponent {
 public:
@@ -35,7 +36,9 @@ public:
   }
 
   void getNextAudioBlock(const juce::AudioSourceChannelInfo& info) override {
-    DBG("getNextAudioBlock() thread ID: " << getCurrentThreadId());
+    // DBG could allocate and lock on the audio thread
+    logger.log("getNextAudioBlock() thread ID: {x}",
+               {getCurrentThreadIdValue()});
 
     info.clearActiveBufferRegion();
   }
@@ -46,11 +49,15 @@ public:
 
 private:
   [[nodiscard]] static juce::String getCurrentThreadId() {
-    return juce::String::toHexString(
-        std::bit_cast<juce::int64>(juce::Thread::getCurrentThreadId()));
+    return juce::String::toHexString(getCurrentThreadIdValue());
+  }
+
+  [[nodiscard]] static juce::int64 getCurrentThreadIdValue() noexcept {
+    return std::bit_cast<juce::int64>(juce::Thread::getCurrentThreadId());
   }
 
   juce::TextButton button{"Click me!"};
+  RealtimeLogger logger;
 };
 
 using MainComponent = GuiAndAudioThreadIdPrinting;
@@ -0,0 +1,144 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+#include <variant>
+
+/** Logs from the audio thread without locking or allocating.
+ *
+ * log() copies a fixed-size record, i.e., a format string literal and its
+ * arguments, into a preallocated ring. A background thread formats the
+ * records and writes them to stderr or to a file.
+ *
+ * Only one thread may call log(), e.g., the audio thread. Log from other
+ * threads with DBG as usual.
+ */
+class RealtimeLogger : private juce::Thread {
+public:
+  /** A number to substitute for the next "{}" (decimal) or "{x}" (hex) */
+  using Argument = std::variant<juce::int64, double>;
+
+  static constexpr auto capacity = 1024;
+  static constexpr auto maxArgumentCount = 4u;
+
+  /** @param logFile the file to append to; writes to stderr if it's empty */
+  explicit RealtimeLogger(const juce::File& logFile = {})
+      : juce::Thread{"RealtimeLogger"} {
+    if (logFile != juce::File{}) {
+      fileStream = std::make_unique<juce::FileOutputStream>(logFile);
+      if (fileStream->failedToOpen()) {
+        fileStream.reset();
+      }
+    }
+    startThread(juce::Thread::Priority::background);
+  }
+
+  ~RealtimeLogger() override {
+    stopThread(1000);
+    drain();
+  }
+
+  /** @brief Queues a message; never blocks or allocates.
+   *
+   * @param format must be a string literal or otherwise outlive the logger
+   * @return false if the ring is full and the message got dropped
+   */
+  bool log(const char* format,
+           std::initializer_list<Argument> arguments = {}) noexcept {
+    const auto scope = fifo.write(1);
+    const auto index = scope.blockSize1 > 0 ? scope.startIndex1
+                       : scope.blockSize2 > 0 ? scope.startIndex2
+                                              : -1;
+    if (index < 0) {
+      droppedCount.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    auto& record = records[static_cast<size_t>(index)];
+    record.format = format;
+    record.argumentCount = 0u;
+    for (const auto& argument : arguments) {
+      if (record.argumentCount == maxArgumentCount) {
+        break;
+      }
+      record.arguments[record.argumentCount++] = argument;
+    }
+    return true;
+  }
+
+private:
+  struct Record {
+    const char* format{""};
+    std::array<Argument, maxArgumentCount> arguments{};
+    size_t argumentCount{0u};
+  };
+
+  void run() override {
+    while (!threadShouldExit()) {
+      drain();
+      // polling: waking this thread up from log() could lock
+      wait(20);
+    }
+  }
+
+  void drain() {
+    const auto scope = fifo.read(fifo.getNumReady());
+    scope.forEach([this](int index) {
+      write(format(records[static_cast<size_t>(index)]));
+    });
+
+    if (const auto dropped = droppedCount.exchange(0); dropped > 0) {
+      write("RealtimeLogger: dropped " + juce::String{dropped} +
+            " message(s)");
+    }
+  }
+
+  [[nodiscard]] static juce::String format(const Record& record) {
+    juce::String text;
+    auto argumentIndex = 0u;
+
+    for (auto remaining = juce::String::CharPointerType{record.format};
+         !remaining.isEmpty();) {
+      const auto isHex = juce::CharacterFunctions::compareUpTo(
+                             remaining, juce::CharPointer_ASCII{"{x}"}, 3) == 0;
+      const auto isDecimal = juce::CharacterFunctions::compareUpTo(
+                                 remaining, juce::CharPointer_ASCII{"{}"},
+                                 2) == 0;
+
+      if ((isHex || isDecimal) && argumentIndex < record.argumentCount) {
+        text << formatArgument(record.arguments[argumentIndex++], isHex);
+        remaining += isHex ? 3 : 2;
+      } else {
+        text << remaining.getAndAdvance();
+      }
+    }
+
+    return text;
+  }
+
+  [[nodiscard]] static juce::String formatArgument(const Argument& argument,
+                                                   bool asHex) {
+    if (const auto* integer = std::get_if<juce::int64>(&argument)) {
+      return asHex ? juce::String::toHexString(*integer)
+                   : juce::String{*integer};
+    }
+    return juce::String{std::get<double>(argument)};
+  }
+
+  void write(const juce::String& line) {
+    if (fileStream) {
+      fileStream->writeText(line + juce::newLine, false, false, nullptr);
+      fileStream->flush();
+    } else {
+      std::fprintf(stderr, "%s\n", line.toRawUTF8());
+    }
+  }
+
+  juce::AbstractFifo fifo{capacity};
+  std::array<Record, static_cast<size_t>(capacity)> records{};
+  std::atomic<int> droppedCount{0};
+  std::unique_ptr<juce::FileOutputStream> fileStream;
+};
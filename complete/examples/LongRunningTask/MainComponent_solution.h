@@ -1,16 +1,32 @@
 #pragma once
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_events/juce_events.h>
-
-class LongRunningTask : public juce::Component, private juce::Thread {
+#include <array>
+#include <atomic>
+#include <ranges>
+#include <vector>
+
+/** Finds the largest prime number below a limit in the background with one of
+ * two algorithms:
+ *  - trial division on a single thread
+ *  - a segmented sieve on all cores; each segment fits in the L1 cache, and
+ *    idle threads take the next unsieved segment, so no thread sits idle
+ *    while there is work left
+ *
+ * The background threads only update atomics; a timer polls them on the
+ * message thread to update the progress bar. Each run's wall-clock time is
+ * displayed together with the speedup of the sieve over trial division.
+ */
+class LongRunningTask : public juce::Component, private juce::Timer {
 public:
-  LongRunningTask() : juce::Thread{"LongRunningTask"} {
-    startButton.onClick = [this]() {
-      if (startThread()) {
-        progress = 0.0;
-      }
+  LongRunningTask() {
+    trialDivisionButton.onClick = [this]() {
+      start(Algorithm::trialDivision);
     };
-    addAndMakeVisible(startButton);
+    addAndMakeVisible(trialDivisionButton);
+
+    sieveButton.onClick = [this]() { start(Algorithm::segmentedSieve); };
+    addAndMakeVisible(sieveButton);
 
     addAndMakeVisible(progressBar);
 
@@ -20,28 +36,70 @@ public:
     setSize(500, 300);
   }
 
-  ~LongRunningTask() override { stopThread(100); }
+  ~LongRunningTask() override { cancel(); }
 
   void resized() override {
     auto bounds = getLocalBounds();
 
-    startButton.setBounds(bounds.removeFromTop(100).reduced(20));
+    auto buttonBounds = bounds.removeFromTop(100).reduced(20);
+    trialDivisionButton.setBounds(
+        buttonBounds.removeFromLeft(buttonBounds.getWidth() / 2).reduced(5, 0));
+    sieveButton.setBounds(buttonBounds.reduced(5, 0));
     progressBar.setBounds(bounds.removeFromTop(100).reduced(20));
     resultLabel.setBounds(bounds.removeFromTop(100).reduced(20));
   }
 
 private:
+  enum class Algorithm { trialDivision = 0, segmentedSieve = 1 };
+
   static constexpr auto limit = 10'000'000;
+  // odd numbers below the limit; the sieve doesn't store even ones
+  static constexpr auto oddCount = limit / 2;
+  // one byte per odd number; fits in a typical L1 data cache
+  static constexpr auto segmentSize = 32 * 1024;
+  static constexpr auto segmentCount =
+      (oddCount + segmentSize - 1) / segmentSize;
+
+  void start(Algorithm algorithm) {
+    cancel();
+
+    currentAlgorithm = algorithm;
+    progress = 0.0;
+    completedWork = 0;
+    largestPrimeNumberFound = 2;
+    startTimeMs = juce::Time::getMillisecondCounterHiRes();
+
+    if (algorithm == Algorithm::trialDivision) {
+      totalWork = limit;
+      threadPool.addJob([this]() { findLargestPrimeByTrialDivision(); });
+    } else {
+      totalWork = segmentCount;
+      nextSegment = 0;
+      findBasePrimes();
+      for ([[maybe_unused]] const auto i :
+           std::views::iota(0, threadPool.getNumThreads())) {
+        threadPool.addJob([this]() { sieveSegments(); });
+      }
+    }
 
-  void findLargestPrimeNumberWithinLimit() {
-    auto progressPercent = 0;
-    constexpr auto progressMultiplier = 100.0 / limit;
+    // polling instead of posting a message per progress step keeps the
+    // message queue free no matter how fast the threads progress
+    startTimerHz(30);
+  }
+
+  void cancel() {
+    stopTimer();
+    cancelled = true;
+    threadPool.removeAllJobs(true, 10'000);
+    cancelled = false;
+  }
 
-    auto largestPrimeNumberFound = 2;
+  void findLargestPrimeByTrialDivision() {
+    auto largestPrimeFound = 2;
 
     for (int currentExaminedNumber = 3; currentExaminedNumber < limit;
          currentExaminedNumber += 2) {
-      if (threadShouldExit()) {
+      if (cancelled) {
         return;
       }
 
@@ -55,35 +113,143 @@ private:
       }
 
       if (isPrime) {
-        largestPrimeNumberFound = currentExaminedNumber;
+        largestPrimeFound = currentExaminedNumber;
+      }
+
+      completedWork.store(currentExaminedNumber, std::memory_order_relaxed);
+    }
+
+    largestPrimeNumberFound = largestPrimeFound;
+    completedWork = limit;
+  }
+
+  /** @brief Finds the odd primes needed to sieve all segments, i.e., up to the
+   * square root of the limit */
+  void findBasePrimes() {
+    const auto maxBasePrime = static_cast<int>(std::sqrt(limit)) + 1;
+    std::vector<bool> isComposite(static_cast<size_t>(maxBasePrime) + 1u);
+    basePrimes.clear();
+
+    for (auto i = 3; i <= maxBasePrime; i += 2) {
+      if (isComposite[static_cast<size_t>(i)]) {
+        continue;
+      }
+
+      basePrimes.push_back(i);
+      for (auto multiple = i * i; multiple <= maxBasePrime;
+           multiple += 2 * i) {
+        isComposite[static_cast<size_t>(multiple)] = true;
+      }
+    }
+  }
+
+  void sieveSegments() {
+    std::vector<juce::uint8> isComposite(segmentSize);
+
+    while (!cancelled) {
+      const auto segment = nextSegment.fetch_add(1);
+      if (segment >= segmentCount) {
+        return;
       }
 
-      const auto newProgressPercent =
-          static_cast<int>(currentExaminedNumber * progressMultiplier);
-      if (progressPercent < newProgressPercent) {
-        progressPercent = newProgressPercent;
-        const auto newProgress = juce::jmap(
-            static_cast<double>(progressPercent), 0.0, 100.0, 0.0, 1.0);
-        juce::MessageManager::callAsync(
-            [this, newProgress]() { progress = newProgress; });
+      updateLargestPrimeNumberFound(sieveSegment(segment, isComposite));
+      completedWork.fetch_add(1);
+    }
+  }
+
+  /** @return the largest prime in the segment or 2 if there's none */
+  int sieveSegment(int segment, std::vector<juce::uint8>& isComposite) const {
+    // the segment holds odd numbers low, low + 2, ..., high - 2
+    const auto firstIndex = segment * segmentSize;
+    const auto indexCount = std::min(segmentSize, oddCount - firstIndex);
+    const auto low = 2 * firstIndex + 1;
+    const auto high = low + 2 * indexCount;
+
+    std::fill_n(isComposite.begin(), indexCount, juce::uint8{0});
+
+    for (const auto prime : basePrimes) {
+      if (prime * prime >= high) {
+        break;
+      }
+
+      // the first odd multiple of the prime within the segment that isn't
+      // the prime itself
+      auto multiple =
+          std::max(prime * prime, (low + prime - 1) / prime * prime);
+      if (multiple % 2 == 0) {
+        multiple += prime;
+      }
+
+      for (; multiple < high; multiple += 2 * prime) {
+        isComposite[static_cast<size_t>((multiple - low) / 2)] = 1;
+      }
+    }
+
+    for (auto index = indexCount - 1; index >= 0; --index) {
+      const auto number = low + 2 * index;
+      if (isComposite[static_cast<size_t>(index)] == 0 && number > 1) {
+        return number;
       }
     }
 
-    juce::MessageManager::callAsync([this, largestPrimeNumberFound]() {
-      progress = 1.0;
-      resultLabel.setText(
-          "Largest prime number < " + juce::String{limit} +
-              " found: " + juce::String{largestPrimeNumberFound},
-          juce::dontSendNotification);
-    });
+    return 2;
   }
 
-  void run() override { findLargestPrimeNumberWithinLimit(); }
+  void updateLargestPrimeNumberFound(int prime) {
+    auto largest = largestPrimeNumberFound.load();
+    while (largest < prime &&
+           !largestPrimeNumberFound.compare_exchange_weak(largest, prime)) {
+    }
+  }
+
+  void timerCallback() override {
+    const auto completed = completedWork.load();
+    progress = static_cast<double>(completed) / static_cast<double>(totalWork);
+
+    if (completed < totalWork) {
+      return;
+    }
+
+    stopTimer();
+    const auto elapsedMs =
+        juce::Time::getMillisecondCounterHiRes() - startTimeMs;
+    elapsedTimesMs[static_cast<size_t>(currentAlgorithm)] = elapsedMs;
 
-  juce::TextButton startButton{"Click to start looking for prime numbers"};
+    auto text = "Largest prime number < " + juce::String{limit} +
+                " found: " + juce::String{largestPrimeNumberFound.load()} +
+                " in " + juce::String{elapsedMs, 0} + " ms";
+
+    const auto [trialDivisionMs, sieveMs] = elapsedTimesMs;
+    if (trialDivisionMs > 0.0 && sieveMs > 0.0) {
+      text << "\nThe sieve is " << juce::String{trialDivisionMs / sieveMs, 1}
+           << "x faster than trial division";
+    }
+
+    resultLabel.setText(text, juce::dontSendNotification);
+  }
+
+  juce::TextButton trialDivisionButton{"Trial division (1 thread)"};
+  juce::TextButton sieveButton{"Segmented sieve (all cores)"};
   double progress{0.0};
   juce::ProgressBar progressBar{progress, juce::ProgressBar::Style::linear};
   juce::Label resultLabel{"result label", "The result should appear here"};
+
+  Algorithm currentAlgorithm{Algorithm::trialDivision};
+  int totalWork{1};
+  double startTimeMs{0.0};
+  std::array<double, 2u> elapsedTimesMs{};
+  std::vector<int> basePrimes;
+
+  std::atomic<bool> cancelled{false};
+  std::atomic<int> completedWork{0};
+  std::atomic<int> nextSegment{0};
+  std::atomic<int> largestPrimeNumberFound{2};
+
+  // declared last to stop the jobs before other members are destroyed
+  juce::ThreadPool threadPool{juce::ThreadPoolOptions{}
+                                  .withThreadName("LongRunningTask")
+                                  .withNumberOfThreads(
+                                      juce::SystemStats::getNumCpus())};
 };
 
 using MainComponent = LongRunningTask;
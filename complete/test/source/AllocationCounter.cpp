@@ -0,0 +1,113 @@
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+struct AllocationStats {
+  bool counting;
+  size_t count;
+  size_t bytes;
+};
+
+constinit thread_local AllocationStats stats{};
+
+constinit std::atomic<bool> countingAllThreads{false};
+constinit std::atomic<size_t> allThreadsCount{0u};
+constinit std::atomic<size_t> allThreadsBytes{0u};
+
+void* allocate(size_t size) noexcept {
+  if (stats.counting) {
+    ++stats.count;
+    stats.bytes += size;
+  }
+  if (countingAllThreads.load(std::memory_order_relaxed)) {
+    allThreadsCount.fetch_add(1u, std::memory_order_relaxed);
+    allThreadsBytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  return std::malloc(size == 0u ? 1u : size);
+}
+
+void* allocateOrThrow(size_t size) {
+  if (auto* memory = allocate(size)) {
+    return memory;
+  }
+  throw std::bad_alloc{};
+}
+}  // namespace
+
+void* operator new(size_t size) {
+  return allocateOrThrow(size);
+}
+
+void* operator new[](size_t size) {
+  return allocateOrThrow(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return allocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+  std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+  std::free(memory);
+}
+
+namespace tremolo {
+ScopedAllocationCounter::ScopedAllocationCounter(
+    AllocationScope scopeToCount) noexcept
+    : scope{scopeToCount} {
+  if (scope == AllocationScope::allThreads) {
+    allThreadsCount = 0u;
+    allThreadsBytes = 0u;
+    countingAllThreads = true;
+  } else {
+    stats = {.counting = true, .count = 0u, .bytes = 0u};
+  }
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter() noexcept {
+  if (scope == AllocationScope::allThreads) {
+    countingAllThreads = false;
+  } else {
+    stats.counting = false;
+  }
+}
+
+size_t ScopedAllocationCounter::getAllocationCount() const noexcept {
+  if (scope == AllocationScope::allThreads) {
+    return allThreadsCount;
+  }
+  return stats.count;
+}
+
+size_t ScopedAllocationCounter::getAllocatedBytes() const noexcept {
+  if (scope == AllocationScope::allThreads) {
+    return allThreadsBytes;
+  }
+  return stats.bytes;
+}
+}  // namespace tremolo
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+
+namespace tremolo {
+enum class AllocationScope {
+  callingThread,
+  // includes background threads, e.g., the ones of thread pools
+  allThreads,
+};
+
+/** Counts the heap allocations made while it is alive, either on the calling
+ * thread or on all threads.
+ *
+ * Relies on the replacement of the global operator new in
+ * AllocationCounter.cpp. Over-aligned allocations are not counted.
+ * Instances must not be nested.
+ */
+class ScopedAllocationCounter {
+public:
+  explicit ScopedAllocationCounter(
+      AllocationScope scope = AllocationScope::callingThread) noexcept;
+  ~ScopedAllocationCounter() noexcept;
+
+  ScopedAllocationCounter(const ScopedAllocationCounter&) = delete;
+  ScopedAllocationCounter& operator=(const ScopedAllocationCounter&) = delete;
+  ScopedAllocationCounter(ScopedAllocationCounter&&) = delete;
+  ScopedAllocationCounter& operator=(ScopedAllocationCounter&&) = delete;
+
+  [[nodiscard]] size_t getAllocationCount() const noexcept;
+  [[nodiscard]] size_t getAllocatedBytes() const noexcept;
+
+private:
+  AllocationScope scope;
+};
+}  // namespace tremolo
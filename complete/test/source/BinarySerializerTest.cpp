@@ -0,0 +1,201 @@
+#include "AllocationCounter.h"
+#include "TestUtils.h"
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+TEST(BinarySerializer, RoundTrip) {
+  PluginProcessor source;
+  auto& sourceParameters = source.getParameterRefs();
+  sourceParameters.rate = 10.f;
+  sourceParameters.bypassed = true;
+  sourceParameters.waveform = 1;
+  sourceParameters.harmonic = true;
+  sourceParameters.dynamicDepth = true;
+  sourceParameters.morph = 0.75f;
+  sourceParameters.depth = 0.8f;
+  sourceParameters.mix = 0.5f;
+  sourceParameters.tempoSync = 4;
+
+  const auto state = BinarySerializer::serialize(sourceParameters);
+
+  PluginProcessor destination;
+  auto& parameters = destination.getParameterRefs();
+  const auto result =
+      BinarySerializer::deserialize(state.data(), state.size(), parameters);
+
+  EXPECT_TRUE(result.wasOk());
+  EXPECT_FLOAT_EQ(parameters.rate, 10.f);
+  EXPECT_TRUE(parameters.bypassed);
+  EXPECT_EQ(juce::String{"Triangle"},
+            parameters.waveform.getCurrentChoiceName());
+  EXPECT_TRUE(parameters.harmonic);
+  EXPECT_TRUE(parameters.dynamicDepth);
+  EXPECT_NEAR(0.75f, parameters.morph, 1e-3f);
+  EXPECT_NEAR(0.8f, parameters.depth, 1e-3f);
+  EXPECT_NEAR(0.5f, parameters.mix, 1e-3f);
+  EXPECT_EQ(juce::String{"1/4"}, parameters.tempoSync.getCurrentChoiceName());
+}
+
+TEST(BinarySerializer, RejectsUnsupportedVersionAndFlags) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+  auto state = BinarySerializer::serialize(parameters);
+
+  auto otherVersion = state;
+  otherVersion[4] = 2u;
+  EXPECT_EQ(0uz, BinarySerializer::getStateSize(otherVersion.data(),
+                                                otherVersion.size()));
+  EXPECT_TRUE(BinarySerializer::deserialize(otherVersion.data(),
+                                            otherVersion.size(), parameters)
+                  .failed());
+
+  state[10] |= 0b1000u;  // no such flag
+  EXPECT_TRUE(
+      BinarySerializer::deserialize(state.data(), state.size(), parameters)
+          .failed());
+}
+
+TEST(BinarySerializer, TellsBinaryAndJsonStatesApart) {
+  PluginProcessor processor;
+  const auto binaryState =
+      BinarySerializer::serialize(processor.getParameterRefs());
+  juce::MemoryOutputStream jsonState;
+  JsonSerializer::serialize(processor.getParameterRefs(), jsonState);
+
+  EXPECT_TRUE(
+      BinarySerializer::isBinaryState(binaryState.data(), binaryState.size()));
+  EXPECT_FALSE(BinarySerializer::isBinaryState(jsonState.getData(),
+                                               jsonState.getDataSize()));
+}
+
+TEST(BinarySerializer, ProcessorLoadsJsonState) {
+  const juce::String savedParameters =
+      u8R"({
+  "__version__": 1,
+  "pluginName": "Tremolo",
+  "modulationRateHz": 10.0,
+  "bypassed": true,
+  "modulationWaveform": "Triangle"
+})";
+
+  PluginProcessor processor;
+  processor.setStateInformation(savedParameters.toRawUTF8(),
+                                static_cast<int>(savedParameters.length()));
+
+  const auto& parameters = processor.getParameterRefs();
+  EXPECT_FLOAT_EQ(parameters.rate, 10.f);
+  EXPECT_TRUE(parameters.bypassed);
+  EXPECT_EQ(1, parameters.waveform.getIndex());
+}
+
+TEST(BinarySerializer, DontUpdateParametersWhenStateIsInvalid) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+  parameters.waveform = 0;
+  parameters.bypassed = false;
+  parameters.rate = 5.f;
+
+  auto state = BinarySerializer::serialize(parameters);
+  state[11] = 7u;  // no such waveform
+
+  EXPECT_TRUE(
+      BinarySerializer::deserialize(state.data(), state.size(), parameters)
+          .failed());
+  EXPECT_TRUE(
+      BinarySerializer::deserialize(state.data(), state.size() - 1u, parameters)
+          .failed());
+  EXPECT_FLOAT_EQ(parameters.rate, 5.f);
+  EXPECT_FALSE(parameters.bypassed);
+  EXPECT_EQ(0, parameters.waveform.getIndex());
+}
+
+/** This benchmark measures the time it takes to save and load the state in
+ * both formats, as hosts do on every autosave or undo snapshot.
+ *
+ * Encoding and decoding the binary state must not allocate.
+ */
+TEST(BinarySerializer, CompareWithJson) {
+  constexpr auto iterations = 10'000;
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+  parameters.rate = 10.f;
+
+  auto jsonFailureCount = 0;
+  const auto jsonMs = measureTimeMs([&] {
+    for ([[maybe_unused]] const auto i : std::views::iota(0, iterations)) {
+      juce::MemoryOutputStream output;
+      JsonSerializer::serialize(parameters, output);
+      juce::MemoryInputStream input{output.getData(), output.getDataSize(),
+                                    false};
+      jsonFailureCount +=
+          JsonSerializer::deserialize(input, parameters).failed() ? 1 : 0;
+    }
+  });
+
+  auto binaryFailureCount = 0;
+  size_t binaryAllocationCount{0u};
+  const auto binaryMs = measureTimeMs([&] {
+    const ScopedAllocationCounter allocationCounter;
+    for ([[maybe_unused]] const auto i : std::views::iota(0, iterations)) {
+      const auto state = BinarySerializer::serialize(parameters);
+      binaryFailureCount +=
+          BinarySerializer::deserialize(state.data(), state.size(), parameters)
+                  .failed()
+              ? 1
+              : 0;
+    }
+    binaryAllocationCount = allocationCounter.getAllocationCount();
+  });
+
+  recordBenchmarkResult("jsonRoundTripsMs", jsonMs);
+  recordBenchmarkResult("binaryRoundTripsMs", binaryMs);
+
+  EXPECT_EQ(0, jsonFailureCount);
+  EXPECT_EQ(0, binaryFailureCount);
+  EXPECT_EQ(0u, binaryAllocationCount);
+  EXPECT_FLOAT_EQ(parameters.rate, 10.f);
+}
+
+TEST(BinarySerializer, CustomLfoShapeRoundTrip) {
+  const CustomLfoShape shape{std::vector<CustomLfoShape::Breakpoint>{
+      {.phase = 0.1f, .value = 0.5f}, {.phase = 0.6f, .value = -0.25f}}};
+
+  std::vector<juce::uint8> bytes(BinarySerializer::getSerializedSize(shape));
+  BinarySerializer::serialize(shape, bytes);
+
+  EXPECT_EQ(shape, BinarySerializer::deserializeCustomLfoShape(bytes.data(),
+                                                               bytes.size()));
+  EXPECT_FALSE(BinarySerializer::deserializeCustomLfoShape(bytes.data(),
+                                                           bytes.size() - 1u)
+                   .has_value());
+}
+
+TEST(BinarySerializer, ProcessorStateKeepsCustomLfoShape) {
+  const CustomLfoShape shape{std::vector<CustomLfoShape::Breakpoint>{
+      {.phase = 0.f, .value = 1.f}, {.phase = 0.5f, .value = -1.f}}};
+  PluginProcessor source;
+  source.setCustomLfoShape(shape);
+  juce::MemoryBlock state;
+  source.getStateInformation(state);
+
+  PluginProcessor destination;
+  destination.setStateInformation(state.getData(),
+                                  static_cast<int>(state.getSize()));
+
+  EXPECT_EQ(shape, destination.getCustomLfoShape());
+}
+
+TEST(BinarySerializer, PresetStateKeepsCustomLfoShape) {
+  const CustomLfoShape shape{std::vector<CustomLfoShape::Breakpoint>{
+      {.phase = 0.f, .value = 1.f}, {.phase = 0.5f, .value = -1.f}}};
+  PluginProcessor processor;
+  processor.setCustomLfoShape(shape);
+
+  // presets store the parameters only
+  const auto state = BinarySerializer::serialize(processor.getParameterRefs());
+  processor.setStateInformation(state.data(), static_cast<int>(state.size()));
+
+  EXPECT_EQ(shape, processor.getCustomLfoShape());
+}
+}  // namespace tremolo
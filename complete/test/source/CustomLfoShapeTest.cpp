@@ -0,0 +1,52 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+TEST(CustomLfoShape, InterpolatesBetweenBreakpointsAcrossThePeriod) {
+  const CustomLfoShape testee{std::vector<CustomLfoShape::Breakpoint>{
+      {.phase = 0.25f, .value = 1.f}, {.phase = 0.75f, .value = -1.f}}};
+
+  EXPECT_FLOAT_EQ(1.f, testee.getValueAt(0.25f));
+  EXPECT_FLOAT_EQ(0.f, testee.getValueAt(0.5f));
+  EXPECT_FLOAT_EQ(-1.f, testee.getValueAt(0.75f));
+  // the segment from the last to the first breakpoint wraps around
+  EXPECT_FLOAT_EQ(0.f, testee.getValueAt(0.f));
+  EXPECT_FLOAT_EQ(-0.5f, testee.getValueAt(0.875f));
+}
+
+TEST(CustomLfoShape, SortsAndClampsBreakpoints) {
+  const CustomLfoShape testee{std::vector<CustomLfoShape::Breakpoint>{
+      {.phase = 0.5f, .value = 3.f},
+      {.phase = -1.f, .value = 0.f},
+      {.phase = 0.25f, .value = std::numeric_limits<float>::quiet_NaN()}}};
+
+  const auto& breakpoints = testee.getBreakpoints();
+  ASSERT_EQ(3u, breakpoints.size());
+  EXPECT_EQ((CustomLfoShape::Breakpoint{.phase = 0.f, .value = 0.f}),
+            breakpoints[0]);
+  EXPECT_EQ((CustomLfoShape::Breakpoint{.phase = 0.25f, .value = 0.f}),
+            breakpoints[1]);
+  EXPECT_EQ((CustomLfoShape::Breakpoint{.phase = 0.5f, .value = 1.f}),
+            breakpoints[2]);
+}
+
+TEST(CustomLfoShape, WithoutBreakpointsIsFlat) {
+  const CustomLfoShape testee{std::vector<CustomLfoShape::Breakpoint>{}};
+
+  EXPECT_FLOAT_EQ(0.f, testee.getValueAt(0.f));
+  EXPECT_FLOAT_EQ(0.f, testee.getValueAt(0.5f));
+}
+
+TEST(CustomLfoShape, CompiledTableMatchesTheShape) {
+  const CustomLfoShape testee;
+  CustomLfoShape::Table table;
+  testee.compileTo(table);
+
+  constexpr auto tableSize = LfoWavetables::tableSize;
+  for (const auto i : std::views::iota(0uz, tableSize)) {
+    const auto phase = static_cast<float>(i) / static_cast<float>(tableSize);
+    ASSERT_FLOAT_EQ(testee.getValueAt(phase), table[i]) << "at index " << i;
+  }
+  EXPECT_EQ(table.front(), table.back());
+}
+}  // namespace tremolo
@@ -0,0 +1,51 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+TEST(EnvelopeFollower, AttacksFasterThanItReleases) {
+  constexpr auto sampleRate = 48000.0;
+  // 5 milliseconds
+  constexpr auto frameCount = 240;
+
+  EnvelopeFollower testee;
+  testee.prepare(sampleRate, 1);
+
+  std::vector<float> input(frameCount, 1.f);
+  const float* channels[] = {input.data()};
+  std::vector<float> levels(frameCount);
+
+  testee.process(channels, 1uz, 0, levels);
+  const auto attacked = levels.back();
+
+  std::ranges::fill(input, 0.f);
+  testee.process(channels, 1uz, 0, levels);
+  const auto released = attacked - levels.back();
+
+  EXPECT_GT(attacked, 0.3f);
+  EXPECT_LT(attacked, 1.f);
+  EXPECT_GT(released, 0.f);
+  EXPECT_LT(released, 0.1f * attacked);
+}
+
+/** More channels than SIMD lanes exercise several channel groups, the last
+ * one partially filled. */
+TEST(EnvelopeFollower, AveragesChannels) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto frameCount = 4800;
+  const auto channelCount = EnvelopeFollower::laneCount + 1uz;
+
+  EnvelopeFollower testee;
+  testee.prepare(sampleRate, static_cast<int>(channelCount));
+
+  // the loud channel has negative samples to check the rectification
+  std::vector<float> loud(frameCount, -1.f);
+  std::vector<float> silent(frameCount, 0.f);
+  std::vector<const float*> channels(channelCount, silent.data());
+  channels.back() = loud.data();
+  std::vector<float> levels(frameCount);
+
+  testee.process(channels.data(), channelCount, 0, levels);
+
+  EXPECT_NEAR(1.f / static_cast<float>(channelCount), levels.back(), 1e-3f);
+}
+}  // namespace tremolo
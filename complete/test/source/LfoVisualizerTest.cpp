@@ -0,0 +1,151 @@
+#include "AllocationCounter.h"
+#include "TestUtils.h"
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+/** This test simulates the GUI frame loop: the audio thread produces a frame's
+ * worth of LFO samples and the visualizer gets updated as on a vertical blank.
+ *
+ * After a few warm-up frames, no frame may allocate on the heap, neither
+ * when plotting the LFO nor when plotting the bypassed flat line.
+ */
+TEST(LfoVisualizer, FrameLoopDoesNotAllocateAfterWarmUp) {
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto frameRate = 60.0;
+  constexpr auto samplesPerFrame = static_cast<int>(sampleRate / frameRate);
+  Tremolo tremolo;
+  tremolo.prepare(sampleRate, samplesPerFrame);
+  auto bypassed = false;
+
+  LfoVisualizer testee{
+      [&](juce::AudioBuffer<float>& buffer) {
+        tremolo.readAllLfoSamples(buffer);
+      },
+      [] { return sampleRate; }, [&] { return bypassed; }};
+  testee.setSize(500, 200);
+
+  juce::AudioBuffer<float> block{1, samplesPerFrame};
+  auto timestampSeconds = 0.0;
+  const auto renderFrame = [&] {
+    block.clear();
+    tremolo.process(block);
+    timestampSeconds += 1.0 / frameRate;
+    testee.update(timestampSeconds);
+  };
+
+  for ([[maybe_unused]] const auto i : std::views::iota(0, 10)) {
+    renderFrame();
+  }
+
+  for (const auto bypassedDuringTest : {false, true}) {
+    bypassed = bypassedDuringTest;
+    const ScopedAllocationCounter allocationCounter;
+
+    for ([[maybe_unused]] const auto i : std::views::iota(0, 600)) {
+      renderFrame();
+    }
+
+    EXPECT_EQ(0u, allocationCounter.getAllocationCount())
+        << "bypassed: " << bypassedDuringTest;
+  }
+}
+
+namespace {
+bool curveCrossesEveryColumn(const juce::Image& frame) {
+  const auto columnContainsCurve = [&](int x) {
+    return std::ranges::any_of(std::views::iota(0, frame.getHeight()),
+                               [&](int y) {
+                                 return frame.getPixelAt(x, y).getBrightness() <
+                                        0.5f;
+                               });
+  };
+  return std::ranges::all_of(std::views::iota(0, frame.getWidth()),
+                             columnContainsCurve);
+}
+}  // namespace
+
+/** This benchmark measures the time it takes to paint a single frame of the
+ * LFO visualizer with each curve renderer.
+ *
+ * Both visualizers plot the same 4 seconds of the LFO as a black curve on a
+ * white background. Both curves must be continuous, i.e., cross every pixel
+ * column.
+ */
+TEST(LfoVisualizer, CurveRendererFramePaintTime) {
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto frameRate = 60.0;
+  constexpr auto samplesPerFrame = static_cast<int>(sampleRate / frameRate);
+  Tremolo tremolo;
+  tremolo.prepare(sampleRate, samplesPerFrame);
+  juce::AudioBuffer<float> block{1, samplesPerFrame};
+  juce::AudioBuffer<float> lfoSamples{1, samplesPerFrame};
+
+  using CurveRenderer = LfoVisualizer::CurveRenderer;
+  const auto createVisualizer = [&](CurveRenderer renderer) {
+    auto visualizer = std::make_unique<LfoVisualizer>(
+        [&](juce::AudioBuffer<float>& buffer) {
+          buffer.makeCopyOf(lfoSamples, true);
+        },
+        [] { return sampleRate; }, [] { return false; }, renderer);
+    visualizer->setSize(600, 200);
+    visualizer->setCurveWidth(2.f);
+    return visualizer;
+  };
+  const auto stroked = createVisualizer(CurveRenderer::pathStroke);
+  const auto scanlined = createVisualizer(CurveRenderer::scanline);
+
+  auto timestampSeconds = 0.0;
+  for ([[maybe_unused]] const auto i :
+       std::views::iota(0, static_cast<int>(4.0 * frameRate))) {
+    block.clear();
+    tremolo.process(block);
+    tremolo.readAllLfoSamples(lfoSamples);
+    timestampSeconds += 1.0 / frameRate;
+    stroked->update(timestampSeconds);
+    scanlined->update(timestampSeconds);
+  }
+
+  const auto paintFrame = [](LfoVisualizer& visualizer) {
+    return visualizer.createComponentSnapshot(visualizer.getLocalBounds());
+  };
+  const auto strokedFrameMs =
+      measureAverageTimeMs([&] { paintFrame(*stroked); });
+  const auto scanlinedFrameMs =
+      measureAverageTimeMs([&] { paintFrame(*scanlined); });
+  recordBenchmarkResult("strokedFramePaintTimeMs", strokedFrameMs);
+  recordBenchmarkResult("scanlineFramePaintTimeMs", scanlinedFrameMs);
+
+  EXPECT_TRUE(curveCrossesEveryColumn(paintFrame(*stroked)));
+  EXPECT_TRUE(curveCrossesEveryColumn(paintFrame(*scanlined)));
+}
+
+TEST(LfoVisualizer, FramePacingFollowsModulationRate) {
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+  std::optional<float> rateHz = 10.f;
+  LfoVisualizer testee{[](juce::AudioBuffer<float>&) {}, [] { return 48000.0; },
+                       [] { return false; }};
+  testee.setSize(600, 100);
+
+  EXPECT_EQ(0.0, testee.getFrameIntervalSeconds());
+
+  constexpr auto maxFrameRate = 60.0;
+  testee.setFramePacing([&] { return rateHz; }, 2.f, maxFrameRate);
+  EXPECT_DOUBLE_EQ(1.0 / maxFrameRate, testee.getFrameIntervalSeconds());
+
+  rateHz = 0.1f;
+  // a 0.1 Hz sine moves by at most 100 / 2.2 * 2 pi * 0.1 pixels per second
+  EXPECT_NEAR(2.0 / (100.0 / 2.2 * juce::MathConstants<double>::twoPi * 0.1),
+              testee.getFrameIntervalSeconds(), 1e-6);
+  EXPECT_GT(testee.getFrameIntervalSeconds(), 4.0 / maxFrameRate);
+
+  // edges jump across the plot at any rate
+  rateHz = std::nullopt;
+  EXPECT_DOUBLE_EQ(1.0 / maxFrameRate, testee.getFrameIntervalSeconds());
+}
+}  // namespace tremolo
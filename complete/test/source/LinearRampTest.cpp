@@ -0,0 +1,56 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+/** Blocks cut the ramp at arbitrary points, and the ramp ends mid-block. */
+TEST(LinearRamp, MatchesLinearSmoothedValue) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto rampLengthSeconds = 0.01;
+
+  LinearRamp testee{0.2f};
+  juce::LinearSmoothedValue<float> reference{0.2f};
+  testee.reset(sampleRate, rampLengthSeconds);
+  reference.reset(sampleRate, rampLengthSeconds);
+  testee.setTargetValue(0.9f);
+  reference.setTargetValue(0.9f);
+
+  for (const auto blockSize : {1uz, 37uz, 128uz, 300uz, 64uz}) {
+    std::vector<float> block(blockSize);
+    testee.fill(block);
+    for (const auto value : block) {
+      ASSERT_NEAR(reference.getNextValue(), value, 1e-5f);
+    }
+    EXPECT_EQ(reference.isSmoothing(), testee.isSmoothing());
+  }
+
+  EXPECT_FLOAT_EQ(0.9f, testee.getCurrentValue());
+}
+
+TEST(LinearRamp, MultiplyAndApplyGainAdvanceOncePerBlock) {
+  constexpr auto sampleRate = 10.0;
+  constexpr auto rampLengthSeconds = 1.0;
+
+  LinearRamp multiplied{1.f};
+  LinearRamp applied{1.f};
+  for (auto* ramp : {&multiplied, &applied}) {
+    ramp->reset(sampleRate, rampLengthSeconds);
+    ramp->setTargetValue(0.f);
+  }
+
+  std::vector<float> samples(5u, 2.f);
+  multiplied.multiply(samples);
+
+  juce::AudioBuffer<float> buffer{2, 5};
+  juce::dsp::AudioBlock<float>{buffer}.fill(2.f);
+  applied.applyGain(buffer, buffer.getNumSamples());
+
+  for (const auto i : std::views::iota(0, 5)) {
+    const auto expected = 2.f * (1.f - 0.1f * static_cast<float>(i + 1));
+    EXPECT_NEAR(expected, samples[static_cast<size_t>(i)], 1e-6f);
+    EXPECT_NEAR(expected, buffer.getSample(0, i), 1e-6f);
+    EXPECT_NEAR(expected, buffer.getSample(1, i), 1e-6f);
+  }
+  EXPECT_NEAR(0.5f, multiplied.getCurrentValue(), 1e-6f);
+  EXPECT_NEAR(0.5f, applied.getCurrentValue(), 1e-6f);
+}
+}  // namespace tremolo
@@ -0,0 +1,80 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+namespace {
+float rms(const float* samples, int count) {
+  auto sum = 0.0;
+  for (const auto i : std::views::iota(0, count)) {
+    sum += static_cast<double>(samples[i]) * static_cast<double>(samples[i]);
+  }
+  return static_cast<float>(std::sqrt(sum / count));
+}
+}  // namespace
+
+/** Summed up, the bands of a Linkwitz-Riley crossover are all-pass filtered
+ * input, so sines of any frequency keep their level. */
+TEST(LinkwitzRileyCrossover, BandsSumToFlatMagnitude) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto sampleCount = 48000;
+  constexpr auto settlingSamples = 4800;
+
+  for (const auto frequencyHz : {50.f, 400.f, 800.f, 1600.f, 10000.f}) {
+    LinkwitzRileyCrossover testee;
+    testee.prepare(sampleRate, 1);
+    testee.setCutoffFrequency(800.f);
+
+    juce::AudioBuffer<float> buffer{1, sampleCount};
+    for (const auto i : std::views::iota(0, sampleCount)) {
+      buffer.setSample(
+          0, i,
+          std::sin(juce::MathConstants<float>::twoPi * frequencyHz *
+                   static_cast<float>(i) / static_cast<float>(sampleRate)));
+    }
+
+    testee.process(buffer, sampleCount,
+                   [](int, auto, auto low, auto high) { return low + high; });
+
+    EXPECT_NEAR(juce::MathConstants<float>::sqrt2 / 2.f,
+                rms(buffer.getReadPointer(0, settlingSamples),
+                    sampleCount - settlingSamples),
+                1e-3f)
+        << "at " << frequencyHz << " Hz";
+  }
+}
+
+/** Channels share SIMD registers; each must be filtered as if alone. */
+TEST(LinkwitzRileyCrossover, FiltersChannelsIndependently) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto channelCount = 5;
+  constexpr auto sampleCount = 1024;
+
+  juce::Random random{42};
+  juce::AudioBuffer<float> multichannel{channelCount, sampleCount};
+  for (const auto channel : std::views::iota(0, channelCount)) {
+    for (const auto i : std::views::iota(0, sampleCount)) {
+      multichannel.setSample(channel, i, 2.f * random.nextFloat() - 1.f);
+    }
+  }
+  auto expected = multichannel;
+
+  LinkwitzRileyCrossover testee;
+  testee.prepare(sampleRate, channelCount);
+  const auto lowOnly = [](int, auto, auto low, auto) { return low; };
+  testee.process(multichannel, sampleCount, lowOnly);
+
+  for (const auto channel : std::views::iota(0, channelCount)) {
+    LinkwitzRileyCrossover mono;
+    mono.prepare(sampleRate, 1);
+    juce::AudioBuffer<float> channelBuffer{
+        expected.getArrayOfWritePointers() + channel, 1, sampleCount};
+    mono.process(channelBuffer, sampleCount, lowOnly);
+
+    for (const auto i : std::views::iota(0, sampleCount)) {
+      ASSERT_FLOAT_EQ(expected.getSample(channel, i),
+                      multichannel.getSample(channel, i))
+          << "channel " << channel << ", sample " << i;
+    }
+  }
+}
+}  // namespace tremolo
@@ -0,0 +1,129 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace tremolo {
+TEST(Parameters, SnapshotFollowsParameterChanges) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+
+  parameters.rate = 10.f;
+  parameters.bypassed = true;
+  parameters.waveform = 1;
+
+  const auto snapshot = parameters.getSnapshot();
+  EXPECT_FLOAT_EQ(10.f, snapshot.rate);
+  EXPECT_TRUE(snapshot.bypassed);
+  EXPECT_EQ(1, snapshot.waveformIndex);
+}
+
+TEST(Parameters, BatchUpdateIsPublishedAtOnce) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+  parameters.rate = 5.f;
+
+  {
+    const Parameters::ScopedBatchUpdate batchUpdate{parameters};
+    parameters.rate = 10.f;
+    parameters.waveform = 1;
+
+    EXPECT_FLOAT_EQ(5.f, parameters.getSnapshot().rate);
+    EXPECT_EQ(0, parameters.getSnapshot().waveformIndex);
+  }
+
+  EXPECT_FLOAT_EQ(10.f, parameters.getSnapshot().rate);
+  EXPECT_EQ(1, parameters.getSnapshot().waveformIndex);
+}
+
+/** A writer thread alternates between two states like a host loading presets
+ * while a reader thread takes snapshots like processBlock() does. Every
+ * snapshot must be one of the two states, never a mix. */
+TEST(Parameters, SnapshotIsNeverTorn) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+  std::atomic<bool> writing{true};
+
+  std::thread writer{[&] {
+    for (const auto i : std::views::iota(0, 10'000)) {
+      const Parameters::ScopedBatchUpdate batchUpdate{parameters};
+      const auto first = i % 2 == 0;
+      parameters.rate = first ? 1.f : 10.f;
+      parameters.bypassed = first;
+      parameters.waveform = first ? 0 : 1;
+    }
+    writing = false;
+  }};
+
+  auto tornSnapshotCount = 0;
+  while (writing) {
+    const auto newSnapshot = parameters.tryGetSnapshot();
+    if (!newSnapshot.has_value()) {
+      continue;
+    }
+    const auto& snapshot = *newSnapshot;
+    const auto rateIs = [&](float rateHz) {
+      return juce::approximatelyEqual(snapshot.rate, rateHz);
+    };
+    const auto isFirst =
+        rateIs(1.f) && snapshot.bypassed && snapshot.waveformIndex == 0;
+    const auto isSecond =
+        rateIs(10.f) && !snapshot.bypassed && snapshot.waveformIndex == 1;
+    const auto isInitial =
+        rateIs(5.f) && !snapshot.bypassed && snapshot.waveformIndex == 0;
+    if (!isFirst && !isSecond && !isInitial) {
+      ++tornSnapshotCount;
+    }
+  }
+  writer.join();
+
+  EXPECT_EQ(0, tornSnapshotCount);
+}
+
+/** Two threads load states at once, so their batches overlap. Once both are
+ * done, the snapshot must hold the final values. */
+TEST(Parameters, OverlappingBatchUpdatesArePublished) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+
+  const auto load = [&](float rateHz) {
+    for ([[maybe_unused]] const auto i : std::views::iota(0, 1'000)) {
+      const Parameters::ScopedBatchUpdate batchUpdate{parameters};
+      parameters.rate = rateHz;
+    }
+  };
+  std::thread first{load, 1.f};
+  std::thread second{load, 10.f};
+  first.join();
+  second.join();
+
+  const auto snapshot = parameters.tryGetSnapshot();
+  ASSERT_TRUE(snapshot.has_value());
+  EXPECT_FLOAT_EQ(parameters.rate.get(), snapshot->rate);
+}
+
+/** Hosts may change parameters on the audio thread while the editor changes
+ * others on the message thread. Writers don't wait for each other, so a
+ * writer that finds another one storing leaves its change to that one; no
+ * change may get lost. */
+TEST(Parameters, ConcurrentWritersPublishAllChanges) {
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+
+  std::thread automation{[&] {
+    for (const auto i : std::views::iota(0, 10'000)) {
+      parameters.rate = static_cast<float>(i % 10 + 1);
+    }
+  }};
+  std::thread editor{[&] {
+    for (const auto i : std::views::iota(0, 10'000)) {
+      parameters.mix = static_cast<float>(i % 10) / 10.f;
+    }
+  }};
+  automation.join();
+  editor.join();
+
+  const auto snapshot = parameters.getSnapshot();
+  EXPECT_FLOAT_EQ(parameters.rate.get(), snapshot.rate);
+  EXPECT_FLOAT_EQ(parameters.mix.get(), snapshot.mix);
+}
+}  // namespace tremolo
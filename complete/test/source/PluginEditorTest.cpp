@@ -0,0 +1,103 @@
+#include "TestUtils.h"
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+/** This test measures the time from calling createEditor() to having the
+ * editor's first frame painted.
+ *
+ * Images are decoded in the background, so the first frame may show the
+ * placeholder instead of the background image. The measured time is
+ * recorded as the "timeToFirstPaintMs" test property.
+ */
+TEST(PluginEditor, TimeToFirstPaint) {
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+  PluginProcessor processor;
+
+  std::unique_ptr<juce::AudioProcessorEditor> editor;
+  juce::Image firstFrame;
+  const auto timeToFirstPaintMs = measureTimeMs([&] {
+    editor.reset(processor.createEditorIfNeeded());
+    if (editor != nullptr) {
+      firstFrame = editor->createComponentSnapshot(editor->getLocalBounds());
+    }
+  });
+  recordBenchmarkResult("timeToFirstPaintMs", timeToFirstPaintMs);
+
+  ASSERT_NE(nullptr, editor);
+  EXPECT_EQ(editor->getLocalBounds(), firstFrame.getBounds());
+}
+
+namespace {
+LfoVisualizer* findLfoVisualizer(juce::Component& editor) {
+  for (auto* child : editor.getChildren()) {
+    if (auto* visualizer = dynamic_cast<LfoVisualizer*>(child)) {
+      return visualizer;
+    }
+  }
+  return nullptr;
+}
+
+bool imagesAreNearlyEqual(const juce::Image& a, const juce::Image& b) {
+  if (a.getBounds() != b.getBounds()) {
+    return false;
+  }
+
+  constexpr auto tolerance = 2;
+  for (const auto y : std::views::iota(0, a.getHeight())) {
+    for (const auto x : std::views::iota(0, a.getWidth())) {
+      const auto pixelA = a.getPixelAt(x, y);
+      const auto pixelB = b.getPixelAt(x, y);
+      if (std::abs(pixelA.getRed() - pixelB.getRed()) > tolerance ||
+          std::abs(pixelA.getGreen() - pixelB.getGreen()) > tolerance ||
+          std::abs(pixelA.getBlue() - pixelB.getBlue()) > tolerance) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace
+
+/** This benchmark measures the time it takes to paint a single frame of the
+ * LFO visualizer with and without the compositing mode.
+ *
+ * Without it, the visualizer is transparent, so each of its repaints paints
+ * the editor and the background in the visualizer's area too. With it, only
+ * the opaque visualizer gets painted. Both must look the same.
+ */
+TEST(PluginEditor, LfoVisualizerFramePaintTime) {
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+  PluginProcessor processor;
+  const juce::SharedResourcePointer<SharedResources> sharedResources;
+  ASSERT_TRUE(sharedResources->waitForImages(10'000));
+
+  const std::unique_ptr<juce::AudioProcessorEditor> editor{
+      processor.createEditorIfNeeded()};
+  ASSERT_NE(nullptr, editor);
+  auto* visualizer = findLfoVisualizer(*editor);
+  ASSERT_NE(nullptr, visualizer);
+  ASSERT_TRUE(visualizer->isOpaque());
+
+  const auto visualizerArea = visualizer->getBounds();
+  const auto compositedFrame =
+      visualizer->createComponentSnapshot(visualizer->getLocalBounds());
+  const auto compositedFrameMs = measureAverageTimeMs([&] {
+    juce::ignoreUnused(
+        visualizer->createComponentSnapshot(visualizer->getLocalBounds()));
+  });
+
+  visualizer->setBackdrop(nullptr);
+  ASSERT_FALSE(visualizer->isOpaque());
+
+  const auto transparentFrame = editor->createComponentSnapshot(visualizerArea);
+  const auto transparentFrameMs = measureAverageTimeMs([&] {
+    juce::ignoreUnused(editor->createComponentSnapshot(visualizerArea));
+  });
+
+  recordBenchmarkResult("compositedFramePaintTimeMs", compositedFrameMs);
+  recordBenchmarkResult("transparentFramePaintTimeMs", transparentFrameMs);
+
+  EXPECT_TRUE(imagesAreNearlyEqual(compositedFrame, transparentFrame));
+}
+}  // namespace tremolo
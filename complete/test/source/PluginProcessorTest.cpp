@@ -1,6 +1,8 @@
+#include "AllocationCounter.h"
 #include "TestUtils.h"
 #include <tremolo_plugin/tremolo_plugin.h>
 #include <gtest/gtest.h>
+#include <thread>
 #include <wolfsound/common/wolfsound_Frequency.hpp>
 #include <wolfsound/file/wolfsound_WavFileWriter.hpp>
 
@@ -13,6 +15,114 @@ TEST(PluginProcessor, PlaceholderTest) {
   PluginProcessor processor{};
 }
 
+/** Hosts poll the state periodically, e.g., on every autosave. Once the host's
+ * block has the state's size, saving the state must not allocate. */
+TEST(PluginProcessor, RepeatedStateSavingDoesNotAllocate) {
+  PluginProcessor processor;
+  juce::MemoryBlock state;
+  processor.getStateInformation(state);
+  const auto savedState = state;
+
+  size_t allocationCount{0u};
+  {
+    const ScopedAllocationCounter allocationCounter;
+    for ([[maybe_unused]] const auto i : std::views::iota(0, 1000)) {
+      processor.getStateInformation(state);
+    }
+    allocationCount = allocationCounter.getAllocationCount();
+  }
+
+  EXPECT_EQ(0u, allocationCount);
+  EXPECT_EQ(savedState, state);
+}
+
+/** Projects saved before the binary state store JSON without the newer
+ * parameters; loading one must reset them rather than keep the instance's
+ * values. */
+TEST(PluginProcessor, LoadingLegacyJsonStateResetsNewerParameters) {
+  const std::string legacyState =
+      R"({"__version__": 1, "pluginName": "Tremolo", )"
+      R"("modulationRateHz": 10.0, "bypassed": false, )"
+      R"("modulationWaveform": "Triangle"})";
+  PluginProcessor processor;
+  auto& parameters = processor.getParameterRefs();
+  parameters.depth = 0.2f;
+  parameters.mix = 0.3f;
+  parameters.harmonic = true;
+
+  processor.setStateInformation(legacyState.data(),
+                                static_cast<int>(legacyState.size()));
+
+  const auto defaultOf = [](const juce::AudioParameterFloat& parameter) {
+    return parameter.convertFrom0to1(parameter.getDefaultValue());
+  };
+  EXPECT_FLOAT_EQ(10.f, parameters.rate.get());
+  EXPECT_EQ(1, parameters.waveform.getIndex());
+  EXPECT_FLOAT_EQ(defaultOf(parameters.depth), parameters.depth.get());
+  EXPECT_FLOAT_EQ(defaultOf(parameters.mix), parameters.mix.get());
+  EXPECT_FALSE(parameters.harmonic.get());
+  EXPECT_FALSE(parameters.dynamicDepth.get());
+  EXPECT_EQ(0, parameters.tempoSync.getIndex());
+}
+
+TEST(PluginProcessor, SupportsMatchingLayoutsUpToMaxChannelCount) {
+  PluginProcessor processor;
+  const auto supports = [&](const juce::AudioChannelSet& input,
+                            const juce::AudioChannelSet& output) {
+    juce::AudioProcessor::BusesLayout layout;
+    layout.inputBuses.add(input);
+    layout.outputBuses.add(output);
+    return processor.checkBusesLayoutSupported(layout);
+  };
+  const auto supportsMatching = [&](const juce::AudioChannelSet& set) {
+    return supports(set, set);
+  };
+
+  EXPECT_TRUE(supportsMatching(juce::AudioChannelSet::mono()));
+  EXPECT_TRUE(supportsMatching(juce::AudioChannelSet::stereo()));
+  EXPECT_TRUE(supportsMatching(juce::AudioChannelSet::create5point1()));
+  EXPECT_TRUE(supportsMatching(juce::AudioChannelSet::create7point1point4()));
+  EXPECT_TRUE(supportsMatching(juce::AudioChannelSet::ambisonic(3)));
+  EXPECT_TRUE(supportsMatching(juce::AudioChannelSet::discreteChannels(
+      PluginProcessor::maxChannelCount)));
+
+  EXPECT_FALSE(supportsMatching(juce::AudioChannelSet::discreteChannels(
+      PluginProcessor::maxChannelCount + 1)));
+  EXPECT_FALSE(supportsMatching(juce::AudioChannelSet::disabled()));
+  EXPECT_FALSE(supports(juce::AudioChannelSet::stereo(),
+                        juce::AudioChannelSet::create5point1()));
+}
+
+TEST(PluginProcessor, ModulatesAllChannelsOfAnAmbisonicLayoutAlike) {
+  PluginProcessor processor;
+  const auto layout = juce::AudioChannelSet::ambisonic(3);
+  juce::AudioProcessor::BusesLayout buses;
+  buses.inputBuses.add(layout);
+  buses.outputBuses.add(layout);
+  // input and output must change together to match at all times
+  ASSERT_TRUE(processor.setBusesLayout(buses));
+
+  constexpr auto blockSize = 256;
+  processor.prepareToPlay(48000.0, blockSize);
+
+  juce::AudioBuffer<float> buffer{layout.size(), blockSize};
+  juce::MidiBuffer midi;
+  for ([[maybe_unused]] const auto block : std::views::iota(0, 8)) {
+    for (const auto channel : std::views::iota(0, buffer.getNumChannels())) {
+      juce::FloatVectorOperations::fill(buffer.getWritePointer(channel), 1.f,
+                                        blockSize);
+    }
+    processor.processBlock(buffer, midi);
+
+    for (const auto channel : std::views::iota(1, buffer.getNumChannels())) {
+      for (const auto frame : std::views::iota(0, blockSize)) {
+        ASSERT_FLOAT_EQ(buffer.getSample(0, frame),
+                        buffer.getSample(channel, frame));
+      }
+    }
+  }
+}
+
 class BypassTransitionIsSmoothTest : public testing::Test {
 protected:
   void SetUp() override {
@@ -66,4 +176,161 @@ TEST_F(BypassTransitionIsSmoothTest, ExerciseAllSegments) {
                  static_cast<size_t>(outputBuffer.getNumSamples())},
       sampleRate);
 }
+
+/** Dragging a breakpoint publishes a new table on every mouse move while the
+ * audio thread glides from the table it played before to the new one. The
+ * old table must stay alive during the glide; run with AddressSanitizer to
+ * catch it being read after it was freed. */
+TEST(PluginProcessor, DraggingCustomShapeWhileProcessing) {
+  constexpr auto blockSize = 32;
+  PluginProcessor processor;
+  processor.getParameterRefs().waveform =
+      static_cast<int>(Tremolo::LfoWaveform::custom);
+  processor.prepareToPlay(48000.0, blockSize);
+  std::atomic<bool> dragging{true};
+
+  std::thread editor{[&] {
+    for (const auto move : std::views::iota(0, 2'000)) {
+      const auto value = static_cast<float>(move % 200) / 100.f - 1.f;
+      std::vector<CustomLfoShape::Breakpoint> breakpoints{
+          {.phase = 0.f, .value = 0.f},
+          {.phase = 0.5f, .value = value},
+          {.phase = 0.75f, .value = 0.f}};
+      processor.setCustomLfoShape(CustomLfoShape{std::move(breakpoints)});
+    }
+    dragging = false;
+  }};
+
+  juce::AudioBuffer<float> buffer{2, blockSize};
+  juce::MidiBuffer midiBuffer;
+  auto outOfRangeCount = 0;
+  while (dragging) {
+    juce::dsp::AudioBlock<float>{buffer}.fill(1.f);
+    processor.processBlock(buffer, midiBuffer);
+
+    for (const auto frame : std::views::iota(0, blockSize)) {
+      const auto sample = buffer.getSample(0, frame);
+      // gliding over jumps may overshoot the LFO's range a little
+      if (!std::isfinite(sample) || std::abs(sample) > 4.f) {
+        ++outOfRangeCount;
+      }
+    }
+  }
+  editor.join();
+
+  EXPECT_EQ(0, outOfRangeCount);
+}
+
+/** All instances compile their custom shapes on one shared thread. Destroying
+ * an instance with compile jobs still queued must remove its jobs only; run
+ * with AddressSanitizer to catch a job writing to a destroyed instance. */
+TEST(PluginProcessor, DestroyingWithQueuedShapeCompilesIsSafe) {
+  const juce::SharedResourcePointer<SharedResources> sharedResources;
+  const auto shapeOfMove = [](int move) {
+    const auto value = static_cast<float>(move % 200) / 100.f - 1.f;
+    std::vector<CustomLfoShape::Breakpoint> breakpoints{
+        {.phase = 0.f, .value = 0.f},
+        {.phase = 0.5f, .value = value},
+        {.phase = 0.75f, .value = 0.f}};
+    return CustomLfoShape{std::move(breakpoints)};
+  };
+
+  PluginProcessor survivor;
+  {
+    PluginProcessor destroyed;
+    for (const auto move : std::views::iota(0, 200)) {
+      destroyed.setCustomLfoShape(shapeOfMove(move));
+      survivor.setCustomLfoShape(shapeOfMove(move));
+    }
+  }
+
+  auto& threadPool = sharedResources->getBackgroundThreadPool();
+  const auto startMs = juce::Time::getMillisecondCounter();
+  while (threadPool.getNumJobs() > 0 &&
+         juce::Time::getMillisecondCounter() - startMs < 10'000u) {
+    juce::Thread::sleep(1);
+  }
+  EXPECT_EQ(0, threadPool.getNumJobs());
+}
+
+/** A parameter that changes while the plugin fades to bypass must sound the
+ * same once the bypass is off as one that changes while fully bypassed. */
+TEST(PluginProcessor, ChangeDuringBypassFadeSettlesWithoutSmoothing) {
+  constexpr auto blockSize = 64;
+  constexpr auto bypassOnBlock = 2;
+  constexpr auto bypassOffBlock = 30;
+
+  const auto render = [](int waveformChangeBlock) {
+    PluginProcessor processor;
+    processor.prepareToPlay(48000.0, blockSize);
+    auto& parameters = processor.getParameterRefs();
+    juce::AudioBuffer<float> buffer{1, blockSize};
+    juce::MidiBuffer midiBuffer;
+    std::vector<float> output;
+
+    for (const auto block : std::views::iota(0, bypassOffBlock + 10)) {
+      if (block == bypassOnBlock) {
+        parameters.bypassed = true;
+      }
+      if (block == waveformChangeBlock) {
+        parameters.waveform = 1;
+      }
+      if (block == bypassOffBlock) {
+        parameters.bypassed = false;
+      }
+
+      juce::dsp::AudioBlock<float>{buffer}.fill(1.f);
+      processor.processBlock(buffer, midiBuffer);
+
+      if (block >= bypassOffBlock) {
+        output.insert(output.end(), buffer.getReadPointer(0),
+                      buffer.getReadPointer(0) + blockSize);
+      }
+    }
+    return output;
+  };
+
+  // the bypass fades over 10 ms, i.e., within 8 blocks
+  const auto changedDuringFade = render(bypassOnBlock + 1);
+  const auto changedWhileBypassed = render(bypassOffBlock - 5);
+
+  ASSERT_EQ(changedWhileBypassed.size(), changedDuringFade.size());
+  for (const auto i : std::views::iota(0uz, changedDuringFade.size())) {
+    ASSERT_NEAR(changedWhileBypassed[i], changedDuringFade[i], 1e-4f)
+        << "at frame " << i;
+  }
+}
+
+/** This benchmark measures the processing throughput for block sizes of 1 to
+ * 32 frames, where the fixed cost of each processBlock() call dominates.
+ *
+ * The parameters don't change during the measurement, as in most of the
+ * blocks a host renders. The results are recorded as the
+ * "nsPerFrameAt<block size>" test properties.
+ */
+TEST(PluginProcessor, TinyBlockThroughput) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto maxBlockSize = 32;
+  constexpr auto framesToProcess = static_cast<int>(sampleRate) * 10;
+
+  PluginProcessor testee;
+  testee.prepareToPlay(sampleRate, maxBlockSize);
+  juce::AudioBuffer<float> buffer{2, maxBlockSize};
+  juce::MidiBuffer midiBuffer;
+
+  for (const auto blockSize : {1, 2, 4, 8, 16, 32}) {
+    buffer.setSize(2, blockSize, false, false, true);
+
+    const auto elapsedMs = measureTimeMs([&] {
+      for ([[maybe_unused]] const auto block :
+           std::views::iota(0, framesToProcess / blockSize)) {
+        juce::dsp::AudioBlock<float>{buffer}.fill(1.f);
+        testee.processBlock(buffer, midiBuffer);
+      }
+    });
+
+    recordBenchmarkResult("nsPerFrameAt" + std::to_string(blockSize),
+                          elapsedMs * 1e6 / framesToProcess);
+  }
+}
 }  // namespace tremolo
@@ -0,0 +1,116 @@
+#include "AllocationCounter.h"
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+class PresetBankTest : public testing::Test {
+protected:
+  void SetUp() override {
+    ASSERT_TRUE(stateDirectory.createDirectory().wasOk());
+  }
+
+  void TearDown() override {
+    stateDirectory.deleteRecursively();
+    bankFile.deleteFile();
+  }
+
+  void writeState(const juce::String& name,
+                  float rateHz,
+                  bool bypassed,
+                  const juce::String& waveform) {
+    const auto state = "{\"__version__\": 1, \"pluginName\": \"Tremolo\", "
+                       "\"modulationRateHz\": " +
+                       juce::String{rateHz} +
+                       ", \"bypassed\": " + (bypassed ? "true" : "false") +
+                       ", \"modulationWaveform\": \"" + waveform + "\"}";
+    ASSERT_TRUE(stateDirectory.getChildFile(name + ".json")
+                    .replaceWithText(state));
+  }
+
+  juce::File stateDirectory =
+      juce::File::getSpecialLocation(juce::File::tempDirectory)
+          .getNonexistentChildFile("TremoloPresetBankTest", "");
+  juce::File bankFile =
+      juce::File::getSpecialLocation(juce::File::tempDirectory)
+          .getNonexistentChildFile("TremoloPresetBankTest", ".bank");
+};
+
+TEST_F(PresetBankTest, BuildsBankFromJsonStates) {
+  writeState("Slow sine", 0.5f, false, "Sine");
+  writeState("Fast triangle", 12.f, false, "Triangle");
+  writeState("Bypassed", 5.f, true, "Sine");
+  writeState("Invalid waveform", 5.f, false, "Foo");
+
+  ASSERT_TRUE(PresetBankBuilder::buildBank(stateDirectory, bankFile).wasOk());
+
+  const PresetBank bank{bankFile};
+  ASSERT_TRUE(bank.isValid());
+  EXPECT_EQ(3u, bank.size());
+  EXPECT_FALSE(bank.find("Invalid waveform").has_value());
+  EXPECT_FALSE(bank.find("Missing").has_value());
+
+  const auto fastTriangle = bank.find("Fast triangle");
+  ASSERT_TRUE(fastTriangle.has_value());
+  EXPECT_EQ("Fast triangle", fastTriangle->name);
+
+  const auto byHash = bank.findByHash(PresetBank::hashName("Fast triangle"));
+  ASSERT_TRUE(byHash.has_value());
+  EXPECT_EQ("Fast triangle", byHash->name);
+
+  PluginProcessor processor;
+  PresetBank::apply(*fastTriangle, processor);
+
+  const auto& parameters = processor.getParameterRefs();
+  EXPECT_FLOAT_EQ(parameters.rate, 12.f);
+  EXPECT_FALSE(parameters.bypassed);
+  EXPECT_EQ(juce::String{"Triangle"},
+            parameters.waveform.getCurrentChoiceName());
+}
+
+/** Switching presets must not allocate; hundreds of presets may be browsed
+ * quickly. */
+TEST_F(PresetBankTest, SwitchingPresetsDoesNotAllocate) {
+  constexpr auto presetCount = 300;
+  for (const auto i : std::views::iota(0, presetCount)) {
+    writeState("Preset " + juce::String{i},
+               0.1f + 0.05f * static_cast<float>(i), i % 2 == 0,
+               i % 3 == 0 ? "Sine" : "Triangle");
+  }
+  ASSERT_TRUE(PresetBankBuilder::buildBank(stateDirectory, bankFile).wasOk());
+
+  const PresetBank bank{bankFile};
+  ASSERT_EQ(static_cast<size_t>(presetCount), bank.size());
+  std::vector<std::string> names;
+  for (const auto i : std::views::iota(0, presetCount)) {
+    names.push_back("Preset " + std::to_string(i));
+  }
+
+  PluginProcessor processor;
+  size_t allocationCount{0u};
+  auto foundCount = 0;
+  {
+    const ScopedAllocationCounter allocationCounter;
+    for (const auto& name : names) {
+      if (const auto preset = bank.find(name)) {
+        PresetBank::apply(*preset, processor);
+        ++foundCount;
+      }
+    }
+    allocationCount = allocationCounter.getAllocationCount();
+  }
+
+  EXPECT_EQ(presetCount, foundCount);
+  EXPECT_EQ(0u, allocationCount);
+  EXPECT_EQ(1, processor.getParameterRefs().waveform.getIndex());
+}
+
+TEST_F(PresetBankTest, RejectsMalformedFile) {
+  ASSERT_TRUE(bankFile.replaceWithText("not a preset bank"));
+
+  const PresetBank bank{bankFile};
+
+  EXPECT_FALSE(bank.isValid());
+  EXPECT_EQ(0u, bank.size());
+  EXPECT_FALSE(bank.find("Preset").has_value());
+}
+}  // namespace tremolo
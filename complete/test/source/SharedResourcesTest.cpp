@@ -0,0 +1,57 @@
+#include "AllocationCounter.h"
+#include "TestUtils.h"
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+#include <numeric>
+
+namespace tremolo {
+/** This test opens several plugin instances with their editors, like a host
+ * session would, and measures how many bytes each additional instance
+ * allocates on any thread, including the shared background thread.
+ *
+ * Since the images, typefaces, and the look-and-feel are shared between
+ * instances, the marginal cost of an instance must stay well below the size of
+ * the decoded background image alone.
+ */
+TEST(SharedResources, MarginalMemoryPerInstanceExcludesSharedAssets) {
+  const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+  const juce::SharedResourcePointer<SharedResources> sharedResources;
+  const auto& threadPool = sharedResources->getBackgroundThreadPool();
+
+  constexpr auto instanceCount = 8u;
+  constexpr auto maxMarginalBytesPerInstance = 1024uz * 1024uz;
+  std::vector<std::unique_ptr<PluginProcessor>> processors;
+  std::vector<std::unique_ptr<juce::AudioProcessorEditor>> editors;
+  std::vector<size_t> allocatedBytes;
+
+  for ([[maybe_unused]] const auto i : std::views::iota(0u, instanceCount)) {
+    const ScopedAllocationCounter allocationCounter{
+        AllocationScope::allThreads};
+    processors.push_back(std::make_unique<PluginProcessor>());
+    editors.emplace_back(processors.back()->createEditorIfNeeded());
+    // count the background work this instance started too
+    while (threadPool.getNumJobs() > 0) {
+      juce::Thread::sleep(1);
+    }
+    allocatedBytes.push_back(allocationCounter.getAllocatedBytes());
+  }
+
+  const auto marginalBytes =
+      std::accumulate(std::next(allocatedBytes.begin()), allocatedBytes.end(),
+                      0uz) /
+      (instanceCount - 1u);
+  recordBenchmarkResult("firstInstanceBytes", allocatedBytes.front());
+  recordBenchmarkResult("marginalBytesPerInstance", marginalBytes);
+  EXPECT_LT(marginalBytes, maxMarginalBytesPerInstance);
+
+  ASSERT_TRUE(sharedResources->waitForImages(10'000));
+  const auto background = sharedResources->getBackgroundImage();
+  const auto decodedBackgroundBytes =
+      static_cast<size_t>(background.getWidth() * background.getHeight()) * 4u;
+  EXPECT_LT(marginalBytes, decodedBackgroundBytes);
+
+  // editors reference their processors
+  editors.clear();
+  processors.clear();
+}
+}  // namespace tremolo
@@ -0,0 +1,50 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+namespace {
+juce::AudioPlayHead::PositionInfo playingAt(double ppq, double bpm) {
+  juce::AudioPlayHead::PositionInfo position;
+  position.setIsPlaying(true);
+  position.setPpqPosition(ppq);
+  position.setBpm(bpm);
+  return position;
+}
+
+int getChoiceIndex(const char* divisionName) {
+  return TempoSync::getChoices().indexOf(divisionName);
+}
+}  // namespace
+
+TEST(TempoSync, PhaseFollowsSongPosition) {
+  const auto quarter = getChoiceIndex("1/4");
+  const auto whole = getChoiceIndex("1/1");
+
+  EXPECT_FLOAT_EQ(
+      0.5f, *TempoSync::getLfoState(quarter, playingAt(5.5, 120.0)).phase);
+  EXPECT_FLOAT_EQ(
+      0.375f, *TempoSync::getLfoState(whole, playingAt(5.5, 120.0)).phase);
+  // pre-roll before the song start
+  EXPECT_FLOAT_EQ(
+      0.75f, *TempoSync::getLfoState(quarter, playingAt(-0.25, 120.0)).phase);
+}
+
+TEST(TempoSync, FrequencyFollowsTempo) {
+  EXPECT_FLOAT_EQ(3.f, TempoSync::getLfoState(getChoiceIndex("1/8"),
+                                              playingAt(0.0, 90.0))
+                           .frequencyHz);
+  EXPECT_FLOAT_EQ(3.f, TempoSync::getLfoState(getChoiceIndex("1/4 T"),
+                                              playingAt(0.0, 120.0))
+                           .frequencyHz);
+}
+
+TEST(TempoSync, FreeRunsWhileStopped) {
+  auto position = playingAt(5.5, 120.0);
+  position.setIsPlaying(false);
+
+  const auto state = TempoSync::getLfoState(getChoiceIndex("1/4"), position);
+
+  EXPECT_FALSE(state.phase.has_value());
+  EXPECT_FLOAT_EQ(2.f, state.frequencyHz);
+}
+}  // namespace tremolo
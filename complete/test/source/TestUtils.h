@@ -1,5 +1,8 @@
 #pragma once
 #include <juce_core/juce_core.h>
+#include <gtest/gtest.h>
+#include <ranges>
+#include <string>
 
 namespace tremolo {
 inline std::string getFileOutputPath(juce::StringRef fileName) {
@@ -10,4 +13,34 @@ inline std::string getFileOutputPath(juce::StringRef fileName) {
       .getFullPathName()
       .toStdString();
 }
+
+/** @return the time a call of run() takes in milliseconds */
+template <typename Run>
+double measureTimeMs(Run&& run) {
+  const auto startMs = juce::Time::getMillisecondCounterHiRes();
+  run();
+  return juce::Time::getMillisecondCounterHiRes() - startMs;
+}
+
+/** @return the average time a call of run() takes in milliseconds */
+template <typename Run>
+double measureAverageTimeMs(Run&& run, int iterationCount = 100) {
+  return measureTimeMs([&] {
+           for ([[maybe_unused]] const auto i :
+                std::views::iota(0, iterationCount)) {
+             run();
+           }
+         }) /
+         iterationCount;
+}
+
+/** @brief Records a benchmark result as a test property.
+ *
+ * Benchmarks don't print; gtest writes the properties to the report
+ * requested with --gtest_output, e.g., --gtest_output=json.
+ */
+template <typename Value>
+void recordBenchmarkResult(const std::string& name, Value value) {
+  testing::Test::RecordProperty(name, std::to_string(value));
+}
 }  // namespace tremolo
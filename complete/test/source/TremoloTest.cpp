@@ -15,8 +15,8 @@ void extractLfo(Tremolo& tremolo, juce::AudioBuffer<float>& bufferToUse) {
 }
 }  // namespace
 
-/** This test extracts the LFO used by the Tremolo effect and saves it to a WAV
- * file "lfo.wav".
+/** This test extracts each LFO waveform used by the Tremolo effect and saves
+ * it to a WAV file, e.g., "sineLfo.wav".
  *
  * You can find the file in the same folder where the test executable resides,
  * most probably [CMake binary dir]/test/.
@@ -25,8 +25,14 @@ void extractLfo(Tremolo& tremolo, juce::AudioBuffer<float>& bufferToUse) {
  * be used.
  */
 TEST(Tremolo, ExtractLfo) {
-  for (const auto lfoWaveform :
-       {Tremolo::LfoWaveform::sine, Tremolo::LfoWaveform::triangle}) {
+  using Waveform = Tremolo::LfoWaveform;
+  for (const auto& [lfoWaveform, fileName] :
+       {std::pair{Waveform::sine, "sineLfo.wav"},
+        std::pair{Waveform::triangle, "triangleLfo.wav"},
+        std::pair{Waveform::square, "squareLfo.wav"},
+        std::pair{Waveform::sawUp, "sawUpLfo.wav"},
+        std::pair{Waveform::sawDown, "sawDownLfo.wav"},
+        std::pair{Waveform::smoothedPulse, "smoothedPulseLfo.wav"}}) {
     Tremolo testee;
     constexpr auto sampleRate = 48000.0;
     testee.setLfoWaveform(lfoWaveform);
@@ -37,10 +43,6 @@ TEST(Tremolo, ExtractLfo) {
 
     extractLfo(testee, buffer);
 
-    const auto* const fileName = lfoWaveform == Tremolo::LfoWaveform::sine
-                                     ? "sineLfo.wav"
-                                     : "triangleLfo.wav";
-
     wolfsound::WavFileWriter::writeToFile(
         getFileOutputPath(fileName),
         juce::Span{buffer.getReadPointer(0),
@@ -89,6 +91,48 @@ TEST(Tremolo, LfoWaveformTransitionIsSmooth) {
       wolfsound::Frequency{sampleRate});
 }
 
+/** Switching the waveform must fade linearly from the old LFO value to the
+ * new waveform instead of sweeping through the waveforms in between. */
+TEST(Tremolo, WaveformSwitchFadesOutTheJump) {
+  constexpr auto sampleRate = 48000.0;
+  // a 5 Hz LFO at an eighth of its period, where the sine and the square
+  // differ
+  constexpr auto framesBeforeSwitch = 1200;
+  // the fade takes 25 ms
+  constexpr auto fadeFrames = 1200;
+
+  Tremolo switched;
+  Tremolo square;
+  square.setLfoWaveform(Tremolo::LfoWaveform::square, ApplySmoothing::no);
+  juce::AudioBuffer<float> switchedLfo{1, framesBeforeSwitch};
+  juce::AudioBuffer<float> squareLfo{1, framesBeforeSwitch};
+  for (auto* tremolo : {&switched, &square}) {
+    tremolo->prepare(sampleRate, 2 * fadeFrames, 1);
+  }
+  extractLfo(switched, switchedLfo);
+  extractLfo(square, squareLfo);
+
+  switched.setLfoWaveform(Tremolo::LfoWaveform::square);
+  switchedLfo.setSize(1, 2 * fadeFrames);
+  squareLfo.setSize(1, 2 * fadeFrames);
+  extractLfo(switched, switchedLfo);
+  extractLfo(square, squareLfo);
+
+  const auto difference = [&](int frame) {
+    return switchedLfo.getSample(0, frame) - squareLfo.getSample(0, frame);
+  };
+  const auto jump = difference(0) * static_cast<float>(fadeFrames) /
+                    static_cast<float>(fadeFrames - 1);
+  ASSERT_GT(std::abs(jump), 0.05f);
+  for (const auto frame : std::views::iota(0, 2 * fadeFrames)) {
+    const auto fadedOut =
+        std::max(0.f, 1.f - static_cast<float>(frame + 1) /
+                                static_cast<float>(fadeFrames));
+    ASSERT_NEAR(jump * fadedOut, difference(frame), 1e-4f)
+        << "at frame " << frame;
+  }
+}
+
 TEST(Tremolo, SamplewiseAndChannelwiseProcessingYieldIdenticalResults) {
   using namespace wolfsound::literals;
   using namespace std::chrono_literals;
@@ -122,4 +166,133 @@ TEST(Tremolo, SamplewiseAndChannelwiseProcessingYieldIdenticalResults) {
                 channelwiseBuffer.getSample(0, i), 1e-5f);
   }
 }
+
+/** The crossover passes DC to the low band and the Nyquist frequency to the
+ * high band. In the harmonic mode, the latter must be modulated in opposite
+ * phase to the classic mode. */
+TEST(Tremolo, HarmonicModeModulatesHighBandInOppositePhase) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto sampleCount = 48000;
+  constexpr auto settlingSamples = 4800;
+
+  Tremolo classic;
+  classic.prepare(sampleRate, sampleCount, 1);
+  juce::AudioBuffer<float> modulatedDc{1, sampleCount};
+  extractLfo(classic, modulatedDc);
+
+  Tremolo harmonic;
+  harmonic.prepare(sampleRate, sampleCount, 1);
+  harmonic.setMode(Tremolo::Mode::harmonic, ApplySmoothing::no);
+  juce::AudioBuffer<float> nyquist{1, sampleCount};
+  for (const auto i : std::views::iota(0, sampleCount)) {
+    nyquist.setSample(0, i, i % 2 == 0 ? 1.f : -1.f);
+  }
+  harmonic.process(nyquist);
+
+  for (const auto i : std::views::iota(settlingSamples, sampleCount)) {
+    // DC - 1 equals the classic modulation
+    const auto modulation = modulatedDc.getSample(0, i);
+    ASSERT_NEAR(1.f - modulation, std::abs(nyquist.getSample(0, i)), 1e-3f)
+        << "at sample " << i;
+  }
+}
+
+/** Quiet input gets proportionally less modulation depth, in both processing
+ * methods. */
+TEST(Tremolo, DynamicDepthScalesWithInputLevel) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto sampleCount = 48000;
+  constexpr auto settlingSamples = 4800;
+  // a tenth of the level at which the depth is full
+  constexpr auto quietLevel = 0.025f;
+
+  Tremolo classic;
+  classic.prepare(sampleRate, sampleCount, 1);
+  juce::AudioBuffer<float> modulatedDc{1, sampleCount};
+  extractLfo(classic, modulatedDc);
+
+  Tremolo samplewise;
+  Tremolo channelwise;
+  juce::AudioBuffer<float> samplewiseBuffer{1, sampleCount};
+  juce::AudioBuffer<float> channelwiseBuffer{1, sampleCount};
+  for (auto* testee : {&samplewise, &channelwise}) {
+    testee->prepare(sampleRate, sampleCount, 1);
+    testee->setDynamicDepth(true, ApplySmoothing::no);
+  }
+  juce::dsp::AudioBlock<float>{samplewiseBuffer}.fill(quietLevel);
+  channelwiseBuffer.makeCopyOf(samplewiseBuffer);
+  samplewise.process(samplewiseBuffer);
+  channelwise.processChannelwise(channelwiseBuffer);
+
+  for (const auto i : std::views::iota(settlingSamples, sampleCount)) {
+    const auto expected = 0.1f * modulatedDc.getSample(0, i);
+    ASSERT_NEAR(expected, samplewiseBuffer.getSample(0, i) / quietLevel - 1.f,
+                1e-3f)
+        << "at sample " << i;
+    ASSERT_NEAR(expected,
+                channelwiseBuffer.getSample(0, i) / quietLevel - 1.f, 1e-3f)
+        << "at sample " << i;
+  }
+}
+
+/** A dry/wet mix equals scaling the modulation down; both the depth and the
+ * mix scale it linearly. */
+TEST(Tremolo, DepthAndMixScaleTheModulation) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto sampleCount = 4800;
+
+  Tremolo classic;
+  classic.prepare(sampleRate, sampleCount, 1);
+  juce::AudioBuffer<float> modulatedDc{1, sampleCount};
+  extractLfo(classic, modulatedDc);
+
+  Tremolo testee;
+  testee.prepare(sampleRate, sampleCount, 1);
+  testee.setModulationDepth(0.8f, ApplySmoothing::no);
+  testee.setMix(0.25f, ApplySmoothing::no);
+  juce::AudioBuffer<float> scaled{1, sampleCount};
+  juce::dsp::AudioBlock<float>{scaled}.fill(1.f);
+  testee.processChannelwise(scaled);
+
+  // 0.8 * 0.25 = 0.2 is half of the default depth 0.4
+  for (const auto i : std::views::iota(0, sampleCount)) {
+    ASSERT_NEAR(0.5f * modulatedDc.getSample(0, i),
+                scaled.getSample(0, i) - 1.f, 1e-5f)
+        << "at sample " << i;
+  }
+}
+
+/** With the phase set at each block start, e.g., from the host's song
+ * position, a block renders the same without the blocks before it. */
+TEST(Tremolo, BlockRendersTheSameWithoutPreviousBlocks) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto blockSize = 4096;
+  constexpr auto rateHz = 3.f;
+  constexpr auto firstPhase = 0.3f;
+  const auto secondPhase = std::fmod(
+      firstPhase + static_cast<float>(blockSize * rateHz / sampleRate), 1.f);
+
+  Tremolo continuous;
+  Tremolo fromSecondBlock;
+  for (auto* testee : {&continuous, &fromSecondBlock}) {
+    testee->prepare(sampleRate, blockSize, 1);
+    testee->setModulationRateHz(rateHz, ApplySmoothing::no);
+  }
+
+  juce::AudioBuffer<float> continuousBlock{1, blockSize};
+  continuous.setLfoPhase(firstPhase, ApplySmoothing::no);
+  extractLfo(continuous, continuousBlock);
+  continuous.setLfoPhase(secondPhase);
+  extractLfo(continuous, continuousBlock);
+
+  juce::AudioBuffer<float> independentBlock{1, blockSize};
+  fromSecondBlock.setLfoPhase(secondPhase, ApplySmoothing::no);
+  extractLfo(fromSecondBlock, independentBlock);
+
+  for (const auto i : std::views::iota(0, blockSize)) {
+    ASSERT_FLOAT_EQ(independentBlock.getSample(0, i),
+                    continuousBlock.getSample(0, i))
+        << "at sample " << i;
+  }
+}
 }  // namespace tremolo
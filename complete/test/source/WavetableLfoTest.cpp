@@ -0,0 +1,113 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo {
+TEST(WavetableLfo, SineMatchesStdSin) {
+  constexpr auto sampleRate = 48000.0;
+  constexpr auto frequencyHz = 5.f;
+  WavetableLfo testee;
+  testee.prepare(sampleRate);
+  testee.setFrequency(frequencyHz, true);
+
+  for (const auto i : std::views::iota(0, static_cast<int>(sampleRate))) {
+    const auto expected = std::sin(juce::MathConstants<double>::twoPi *
+                                   frequencyHz * i / sampleRate);
+    ASSERT_NEAR(expected, testee.getNextValue(), 1e-3) << "at sample " << i;
+  }
+}
+
+TEST(WavetableLfo, FillYieldsTheSameValuesAsGetNextValue) {
+  constexpr auto sampleRate = 48000.0;
+  WavetableLfo samplewise;
+  WavetableLfo blockwise;
+  for (auto* lfo : {&samplewise, &blockwise}) {
+    lfo->prepare(sampleRate);
+    lfo->setFrequency(3.f, true);
+    lfo->setWaveform(WavetableLfo::Waveform::sawUp);
+    // ramps the frequency during the first block
+    lfo->setFrequency(12.f);
+  }
+
+  std::vector<float> block(512u);
+  for ([[maybe_unused]] const auto blockIndex : std::views::iota(0, 10)) {
+    blockwise.fill(block);
+    for (const auto value : block) {
+      ASSERT_FLOAT_EQ(samplewise.getNextValue(), value);
+    }
+  }
+}
+
+TEST(WavetableLfo, PositionBetweenWaveformsBlendsThem) {
+  constexpr auto sampleRate = 48000.0;
+  WavetableLfo sine;
+  WavetableLfo triangle;
+  WavetableLfo morphed;
+  for (auto* lfo : {&sine, &triangle, &morphed}) {
+    lfo->prepare(sampleRate);
+    lfo->setFrequency(5.f, true);
+  }
+  triangle.setWaveform(WavetableLfo::Waveform::triangle);
+  morphed.setWaveformPosition(0.25f, true);
+
+  std::vector<float> block(9600u);
+  morphed.fill(block);
+  for (const auto value : block) {
+    const auto sineValue = sine.getNextValue();
+    const auto expected =
+        sineValue + 0.25f * (triangle.getNextValue() - sineValue);
+    ASSERT_NEAR(expected, value, 1e-6f);
+  }
+}
+
+TEST(WavetableLfo, FillYieldsTheSameValuesWhileThePositionGlides) {
+  constexpr auto sampleRate = 48000.0;
+  WavetableLfo samplewise;
+  WavetableLfo blockwise;
+  for (auto* lfo : {&samplewise, &blockwise}) {
+    lfo->prepare(sampleRate);
+    lfo->setFrequency(3.f, true);
+    // glides through the triangle within the first three blocks
+    lfo->setWaveformPosition(2.5f);
+  }
+
+  std::vector<float> block(512u);
+  for ([[maybe_unused]] const auto blockIndex : std::views::iota(0, 10)) {
+    blockwise.fill(block);
+    for (const auto value : block) {
+      ASSERT_FLOAT_EQ(samplewise.getNextValue(), value);
+    }
+  }
+}
+
+TEST(LfoWavetables, TablesAreNormalizedAndStartAtZero) {
+  const juce::SharedResourcePointer<LfoWavetables> wavetables;
+
+  for (const auto waveformIndex :
+       std::views::iota(0uz, LfoWavetables::waveformCount)) {
+    for (const auto mipLevel :
+         std::views::iota(0uz, LfoWavetables::mipLevelCount)) {
+      const auto table = wavetables->getTable(
+          static_cast<LfoWavetables::Waveform>(waveformIndex), mipLevel);
+
+      ASSERT_EQ(LfoWavetables::tableSize + 1uz, table.size());
+      EXPECT_NEAR(0.f, table.front(), 1e-6f);
+      EXPECT_EQ(table.front(), table.back());
+
+      const auto peak = std::ranges::max(
+          table | std::views::transform([](float x) { return std::abs(x); }));
+      EXPECT_FLOAT_EQ(1.f, peak)
+          << "waveform " << waveformIndex << ", mip level " << mipLevel;
+    }
+  }
+}
+
+TEST(LfoWavetables, MipLevelKeepsHarmonicsBelowNyquist) {
+  constexpr auto sampleRate = 48000.0;
+
+  EXPECT_EQ(0uz, LfoWavetables::getMipLevel(20.f, sampleRate));
+  // 512 harmonics of 100 Hz exceed 24 kHz but 128 harmonics don't
+  EXPECT_EQ(2uz, LfoWavetables::getMipLevel(100.f, sampleRate));
+  EXPECT_EQ(LfoWavetables::mipLevelCount - 1uz,
+            LfoWavetables::getMipLevel(20000.f, sampleRate));
+}
+}  // namespace tremolo
@@ -0,0 +1,91 @@
+#include "../TestUtils.h"
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo::detail {
+/** Channel counts up to 17 cover every combination of the 8-, 4-, 2-, and
+ * 1-channel batches; the frames span two full tiles and a partial one. */
+TEST(ChannelBatch, AppliesGainToEveryChannel) {
+  constexpr auto frameCount = 2uz * channelBatchTileSize + 21uz;
+  std::vector<float> gains(frameCount);
+  for (const auto frame : std::views::iota(0uz, frameCount)) {
+    gains[frame] = static_cast<float>(frame) / static_cast<float>(frameCount);
+  }
+
+  for (const auto channelCount : std::views::iota(1uz, 18uz)) {
+    std::vector<std::vector<float>> channels(channelCount,
+                                             std::vector<float>(frameCount));
+    std::vector<float*> channelPointers;
+    for (const auto channel : std::views::iota(0uz, channelCount)) {
+      std::ranges::fill(channels[channel], static_cast<float>(channel + 1uz));
+      channelPointers.push_back(channels[channel].data());
+    }
+
+    applyGainToChannels(channelPointers.data(), channelCount, gains);
+
+    for (const auto channel : std::views::iota(0uz, channelCount)) {
+      for (const auto frame : std::views::iota(0uz, frameCount)) {
+        ASSERT_FLOAT_EQ(static_cast<float>(channel + 1uz) * gains[frame],
+                        channels[channel][frame])
+            << "channel count: " << channelCount << ", channel: " << channel;
+      }
+    }
+  }
+}
+
+/** This benchmark compares the batched kernel with the per-channel
+ * juce::FloatVectorOperations::multiply() loop it replaced, for layouts from
+ * stereo to 64 channels. The results are recorded as the
+ * "nsPerChannelFrame<Batched|PerChannel>At<channel count>" test properties.
+ */
+TEST(ChannelBatch, ThroughputComparedWithPerChannelMultiply) {
+  constexpr auto frameCount = 512;
+  constexpr auto blockCount = 2'000;
+  // unity gains keep the samples from growing or turning denormal
+  const std::vector<float> gains(static_cast<size_t>(frameCount), 1.f);
+
+  for (const auto channelCount : {2, 6, 12, 16, 64}) {
+    juce::AudioBuffer<float> batched{channelCount, frameCount};
+    juce::AudioBuffer<float> perChannel{channelCount, frameCount};
+    for (auto* buffer : {&batched, &perChannel}) {
+      for (const auto channel : std::views::iota(0, channelCount)) {
+        juce::FloatVectorOperations::fill(buffer->getWritePointer(channel),
+                                          static_cast<float>(channel),
+                                          frameCount);
+      }
+    }
+
+    const auto batchedMs = measureTimeMs([&] {
+      for ([[maybe_unused]] const auto block :
+           std::views::iota(0, blockCount)) {
+        applyGainToChannels(batched.getArrayOfWritePointers(),
+                            static_cast<size_t>(channelCount), gains);
+      }
+    });
+    const auto perChannelMs = measureTimeMs([&] {
+      for ([[maybe_unused]] const auto block :
+           std::views::iota(0, blockCount)) {
+        for (const auto channel : std::views::iota(0, channelCount)) {
+          juce::FloatVectorOperations::multiply(
+              perChannel.getWritePointer(channel), gains.data(), frameCount);
+        }
+      }
+    });
+
+    const auto toNsPerChannelFrame = [&](double ms) {
+      return ms * 1e6 /
+             (static_cast<double>(blockCount) * frameCount * channelCount);
+    };
+    const auto suffix = "At" + std::to_string(channelCount);
+    recordBenchmarkResult("nsPerChannelFrameBatched" + suffix,
+                          toNsPerChannelFrame(batchedMs));
+    recordBenchmarkResult("nsPerChannelFramePerChannel" + suffix,
+                          toNsPerChannelFrame(perChannelMs));
+
+    for (const auto channel : std::views::iota(0, channelCount)) {
+      ASSERT_EQ(perChannel.getSample(channel, frameCount - 1),
+                batched.getSample(channel, frameCount - 1));
+    }
+  }
+}
+}  // namespace tremolo::detail
@@ -0,0 +1,64 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace tremolo::detail {
+TEST(CommandQueue, PopsCommandsInOrder) {
+  CommandQueue<int, 4u> testee;
+
+  EXPECT_TRUE(testee.push(1));
+  EXPECT_TRUE(testee.push(2));
+  EXPECT_TRUE(testee.push(3));
+
+  std::vector<int> popped;
+  testee.popAll([&](int command) { popped.push_back(command); });
+
+  EXPECT_EQ((std::vector{1, 2, 3}), popped);
+
+  popped.clear();
+  testee.popAll([&](int command) { popped.push_back(command); });
+  EXPECT_TRUE(popped.empty());
+}
+
+TEST(CommandQueue, DropsCommandsWhenFull) {
+  CommandQueue<int, 2u> testee;
+
+  EXPECT_TRUE(testee.push(1));
+  EXPECT_TRUE(testee.push(2));
+  EXPECT_FALSE(testee.push(3));
+
+  std::vector<int> popped;
+  testee.popAll([&](int command) { popped.push_back(command); });
+  EXPECT_EQ((std::vector{1, 2}), popped);
+
+  EXPECT_TRUE(testee.push(4));
+}
+
+TEST(CommandQueue, PassesCommandsBetweenThreads) {
+  constexpr auto commandCount = 100'000;
+  CommandQueue<int, 64u> testee;
+
+  std::thread producer{[&] {
+    for (const auto command : std::views::iota(0, commandCount)) {
+      while (!testee.push(command)) {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  auto expectedCommand = 0;
+  auto outOfOrderCount = 0;
+  while (expectedCommand < commandCount) {
+    testee.popAll([&](int command) {
+      if (command != expectedCommand) {
+        ++outOfOrderCount;
+      }
+      expectedCommand = command + 1;
+    });
+  }
+  producer.join();
+
+  EXPECT_EQ(0, outOfOrderCount);
+}
+}  // namespace tremolo::detail
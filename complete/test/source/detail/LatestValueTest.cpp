@@ -0,0 +1,56 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace tremolo::detail {
+TEST(LatestValue, ReadsOnlyTheLatestValueOnce) {
+  LatestValue<int> testee;
+  std::vector<int> read;
+  const auto readInto = [&](int value) { read.push_back(value); };
+
+  EXPECT_FALSE(testee.readLatest(readInto));
+
+  testee.write(1);
+  testee.write(2);
+  testee.write(3);
+  EXPECT_TRUE(testee.readLatest(readInto));
+  EXPECT_FALSE(testee.readLatest(readInto));
+
+  testee.write(4);
+  EXPECT_TRUE(testee.readLatest(readInto));
+
+  EXPECT_EQ((std::vector{3, 4}), read);
+}
+
+/** The reader must see increasing values only and, once the writer is done,
+ * the last one. */
+TEST(LatestValue, PassesValuesBetweenThreads) {
+  constexpr auto valueCount = 100'000;
+  LatestValue<int> testee;
+  std::atomic<bool> writing{true};
+
+  std::thread writer{[&] {
+    for (const auto i : std::views::iota(1, valueCount + 1)) {
+      testee.write(i);
+    }
+    writing = false;
+  }};
+
+  auto lastValue = 0;
+  auto outOfOrderCount = 0;
+  const auto check = [&](int value) {
+    if (value <= lastValue) {
+      ++outOfOrderCount;
+    }
+    lastValue = value;
+  };
+  while (writing) {
+    testee.readLatest(check);
+  }
+  writer.join();
+  testee.readLatest(check);
+
+  EXPECT_EQ(0, outOfOrderCount);
+  EXPECT_EQ(valueCount, lastValue);
+}
+}  // namespace tremolo::detail
@@ -0,0 +1,95 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+
+namespace tremolo::detail {
+enum class TestLayer { first, second };
+
+class LayerCacheTest : public testing::Test {
+protected:
+  void draw(TestLayer layer, juce::Rectangle<float> bounds) {
+    testee.draw(g, layer, bounds,
+                [this](juce::Graphics& layerGraphics,
+                       juce::Rectangle<float> layerBounds) {
+                  ++renderCount;
+                  layerGraphics.setColour(juce::Colours::red);
+                  layerGraphics.fillRect(layerBounds);
+                });
+  }
+
+  [[nodiscard]] juce::uint32 getPixel(int x, int y) const {
+    return target.getPixelAt(x, y).getARGB();
+  }
+
+  LayerCache<TestLayer> testee;
+  juce::Image target{juce::Image::ARGB, 100, 100, true,
+                     juce::SoftwareImageType{}};
+  juce::Graphics g{target};
+  int renderCount{0};
+};
+
+TEST_F(LayerCacheTest, RendersLayerOnceAndBlitsItAtAnyPosition) {
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::first, {60.f, 60.f, 20.f, 20.f});
+
+  EXPECT_EQ(1, renderCount);
+  EXPECT_EQ(juce::Colours::red.getARGB(), getPixel(15, 15));
+  EXPECT_EQ(juce::Colours::red.getARGB(), getPixel(65, 65));
+  EXPECT_EQ(juce::Colours::transparentBlack.getARGB(), getPixel(45, 45));
+}
+
+/** e.g., two combo boxes of different widths or two editors at different
+ * scale factors */
+TEST_F(LayerCacheTest, CachesEachSizeOfLayer) {
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::first, {10.f, 10.f, 30.f, 30.f});
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::first, {10.f, 10.f, 30.f, 30.f});
+
+  EXPECT_EQ(2, renderCount);
+  EXPECT_EQ(2u, testee.size());
+  EXPECT_EQ(juce::Colours::red.getARGB(), getPixel(35, 35));
+}
+
+TEST_F(LayerCacheTest, CachesEachScaleOfLayer) {
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  {
+    const juce::Graphics::ScopedSaveState savedState{g};
+    g.addTransform(juce::AffineTransform::scale(2.f));
+    draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  }
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+
+  EXPECT_EQ(2, renderCount);
+  EXPECT_EQ(2u, testee.size());
+  EXPECT_EQ(juce::Colours::red.getARGB(), getPixel(55, 55));
+}
+
+TEST_F(LayerCacheTest, EvictsLeastRecentlyDrawnImage) {
+  testee = LayerCache<TestLayer>{2uz};
+
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::second, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  // evicts the second layer
+  draw(TestLayer::first, {10.f, 10.f, 30.f, 30.f});
+  EXPECT_EQ(3, renderCount);
+  EXPECT_EQ(2u, testee.size());
+
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  EXPECT_EQ(3, renderCount);
+
+  draw(TestLayer::second, {10.f, 10.f, 20.f, 20.f});
+  EXPECT_EQ(4, renderCount);
+  EXPECT_EQ(2u, testee.size());
+}
+
+TEST_F(LayerCacheTest, LayersAreCachedIndependently) {
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::second, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::first, {10.f, 10.f, 20.f, 20.f});
+  draw(TestLayer::second, {10.f, 10.f, 20.f, 20.f});
+
+  EXPECT_EQ(2, renderCount);
+  EXPECT_EQ(2u, testee.size());
+}
+}  // namespace tremolo::detail
@@ -0,0 +1,109 @@
+#include <tremolo_plugin/tremolo_plugin.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace tremolo::detail {
+namespace {
+struct Counted {
+  explicit Counted(int v, std::atomic<int>& liveCount)
+      : value{v}, live{liveCount} {
+    ++live;
+  }
+  ~Counted() { --live; }
+
+  int value;
+  std::atomic<int>& live;
+};
+}  // namespace
+
+TEST(RcuPointer, AcquiresTheLatestPublishedObject) {
+  std::atomic<int> liveCount{0};
+  RcuPointer<Counted> testee;
+
+  EXPECT_EQ(nullptr, testee.acquire());
+
+  testee.publish(std::make_unique<Counted>(1, liveCount));
+  ASSERT_NE(nullptr, testee.acquire());
+  EXPECT_EQ(1, testee.acquire()->value);
+
+  // the second object is never acquired
+  testee.publish(std::make_unique<Counted>(2, liveCount));
+  testee.publish(std::make_unique<Counted>(3, liveCount));
+  EXPECT_EQ(3, testee.acquire()->value);
+}
+
+TEST(RcuPointer, WriterDeletesObjectsTheReaderReleased) {
+  std::atomic<int> liveCount{0};
+  {
+    RcuPointer<Counted> testee;
+    testee.publish(std::make_unique<Counted>(1, liveCount));
+    [[maybe_unused]] const auto* first = testee.acquire();
+
+    testee.publish(std::make_unique<Counted>(2, liveCount));
+    EXPECT_EQ(2, liveCount);
+
+    [[maybe_unused]] const auto* second = testee.acquire();
+    testee.publish(std::make_unique<Counted>(3, liveCount));
+    EXPECT_EQ(3, liveCount);
+
+    // the reader releases the first object here...
+    [[maybe_unused]] const auto* third = testee.acquire();
+    EXPECT_EQ(3, liveCount);
+
+    // ...and the writer deletes it here
+    testee.reclaim();
+    EXPECT_EQ(2, liveCount);
+  }
+  EXPECT_EQ(0, liveCount);
+}
+
+/** e.g., Tremolo::setCustomLfoTable() reads the old table to glide from it
+ * after acquiring the new one */
+TEST(RcuPointer, PreviouslyAcquiredObjectOutlivesNextAcquire) {
+  std::atomic<int> liveCount{0};
+  RcuPointer<Counted> testee;
+  testee.publish(std::make_unique<Counted>(1, liveCount));
+  const auto* first = testee.acquire();
+
+  testee.publish(std::make_unique<Counted>(2, liveCount));
+  [[maybe_unused]] const auto* second = testee.acquire();
+  testee.publish(std::make_unique<Counted>(3, liveCount));
+  testee.reclaim();
+
+  EXPECT_EQ(1, first->value);
+  EXPECT_EQ(3, liveCount);
+}
+
+/** The reader must only ever see completely constructed objects that haven't
+ * been deleted yet, and each object's values must increase monotonically. */
+TEST(RcuPointer, PassesObjectsBetweenThreads) {
+  constexpr auto objectCount = 10'000;
+  std::atomic<int> liveCount{0};
+  RcuPointer<Counted> testee;
+  std::atomic<bool> publishing{true};
+
+  std::thread writer{[&] {
+    for (const auto i : std::views::iota(1, objectCount + 1)) {
+      testee.publish(std::make_unique<Counted>(i, liveCount));
+    }
+    publishing = false;
+  }};
+
+  auto lastValue = 0;
+  auto outOfOrderCount = 0;
+  while (publishing || lastValue != objectCount) {
+    if (const auto* object = testee.acquire()) {
+      if (object->value < lastValue) {
+        ++outOfOrderCount;
+      }
+      lastValue = object->value;
+    }
+  }
+  writer.join();
+
+  EXPECT_EQ(0, outOfOrderCount);
+  testee.reclaim();
+  // the latest object and the one acquired before it
+  EXPECT_LE(liveCount, 2);
+}
+}  // namespace tremolo::detail
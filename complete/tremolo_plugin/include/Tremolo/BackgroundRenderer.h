@@ -0,0 +1,41 @@
+#pragma once
+
+namespace tremolo {
+/** Renders images on a background thread and hands them over to the message
+ * thread.
+ *
+ * Destroying the renderer waits for the image being rendered and drops all
+ * results not yet delivered. Declare it as the last member of the class whose
+ * methods the callbacks call; this way, no callback outlives that class.
+ */
+class BackgroundRenderer : private juce::AsyncUpdater {
+public:
+  using Render = std::function<juce::Image()>;
+  using OnRendered = std::function<void(juce::Image)>;
+
+  BackgroundRenderer();
+  ~BackgroundRenderer() override;
+
+  /** @brief Schedules renderImage() on the background thread and then
+   * onRendered() with its result on the message thread.
+   *
+   * Render into juce::SoftwareImageType images; native images cannot be
+   * safely drawn into outside of the message thread on every platform.
+   */
+  void render(Render renderImage, OnRendered onImageRendered);
+
+private:
+  struct RenderedImage {
+    juce::Image image;
+    OnRendered onRendered;
+  };
+
+  void handleAsyncUpdate() override;
+
+  juce::CriticalSection renderedImagesLock;
+  std::vector<RenderedImage> renderedImages;
+  juce::ThreadPool threadPool;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BackgroundRenderer)
+};
+}  // namespace tremolo
@@ -0,0 +1,65 @@
+#pragma once
+
+namespace tremolo {
+/** Serializes the parameters to a compact, fixed-layout binary state.
+ *
+ * Layout; multi-byte fields are little-endian:
+ *
+ *   bytes 0-3  magic "TRMB"
+ *   bytes 4-5  format version
+ *   bytes 6-9  modulation rate in Hz as an IEEE 754 float
+ *   byte 10    flags; bit 0: bypassed, bit 1: harmonic mode,
+ *              bit 2: dynamic depth
+ *   byte 11    modulation waveform choice index
+ *   bytes 12-15  waveform morph as an IEEE 754 float
+ *   bytes 16-19  modulation depth as an IEEE 754 float
+ *   bytes 20-23  mix as an IEEE 754 float
+ *   byte 24      tempo sync choice index
+ *
+ * Encoding and decoding don't allocate. JSON states never start with the
+ * magic, so isBinaryState() tells both formats apart.
+ *
+ * The plugin state may continue with the custom LFO shape, right after the
+ * getStateSize() bytes of the parameters:
+ *
+ *   bytes 0-3  magic "TRCS"
+ *   bytes 4-5  breakpoint count n
+ *   then, n times, the breakpoint's phase and value as IEEE 754 floats
+ */
+class BinarySerializer {
+public:
+  static constexpr auto stateSize = 25uz;
+  static constexpr juce::uint16 formatVersion = 1u;
+
+  using State = std::array<juce::uint8, stateSize>;
+
+  [[nodiscard]] static State serialize(const Parameters&) noexcept;
+
+  [[nodiscard]] static bool isBinaryState(const void* data,
+                                          size_t sizeInBytes) noexcept;
+
+  /** @return the size of the parameter state at the start of the data; 0 if
+   * the data holds no supported binary state */
+  [[nodiscard]] static size_t getStateSize(const void* data,
+                                           size_t sizeInBytes) noexcept;
+
+  /** @return Error message on failure; empty string otherwise.
+   *           In case of error, no parameters are updated. */
+  static juce::Result deserialize(const void* data,
+                                  size_t sizeInBytes,
+                                  Parameters&);
+
+  [[nodiscard]] static size_t getSerializedSize(
+      const CustomLfoShape&) noexcept;
+
+  /** @brief Writes getSerializedSize() bytes to the destination */
+  static void serialize(const CustomLfoShape&,
+                        std::span<juce::uint8> destination) noexcept;
+
+  /** @return the shape or nothing if the data doesn't start with a valid
+   * one */
+  [[nodiscard]] static std::optional<CustomLfoShape> deserializeCustomLfoShape(
+      const void* data,
+      size_t sizeInBytes);
+};
+}  // namespace tremolo
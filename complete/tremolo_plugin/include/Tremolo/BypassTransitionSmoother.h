@@ -146,8 +146,9 @@ private:
 
   double crossfadeLengthSeconds = 0.0;
   double sampleRateHz = 0.0;
-  juce::LinearSmoothedValue<float> dryGain{0.f};
-  juce::LinearSmoothedValue<float> wetGain{1.f};
+  // ramped a block at a time; see LinearRamp
+  LinearRamp dryGain{0.f};
+  LinearRamp wetGain{1.f};
   juce::AudioBuffer<float> dryBuffer;
 };
 }  // namespace tremolo
@@ -0,0 +1,49 @@
+#pragma once
+
+namespace tremolo {
+/** A user-drawn LFO shape: breakpoints connected by straight lines.
+ *
+ * The shape wraps around, i.e., the last breakpoint connects to the first one
+ * of the next period. Evaluating the breakpoints doesn't belong on the audio
+ * thread; compile the shape to a Table instead.
+ */
+class CustomLfoShape {
+public:
+  struct Breakpoint {
+    /** in [0, 1) */
+    float phase{0.f};
+    /** in [-1, 1] */
+    float value{0.f};
+
+    bool operator==(const Breakpoint&) const = default;
+  };
+
+  /** One period laid out like the tables of LfoWavetables */
+  using Table = std::array<float, LfoWavetables::tableSize + 1uz>;
+
+  static constexpr auto maxBreakpointCount = 64uz;
+
+  /** @brief Creates a triangle starting at 0 like the sine */
+  CustomLfoShape();
+
+  /** @brief Clamps the breakpoints to the valid ranges and sorts them by
+   * phase.
+   *
+   * Keeps at most maxBreakpointCount breakpoints. Without breakpoints, the
+   * shape is a flat line at 0.
+   */
+  explicit CustomLfoShape(std::vector<Breakpoint>);
+
+  [[nodiscard]] const std::vector<Breakpoint>& getBreakpoints() const noexcept;
+
+  /** @param phase in [0, 1) */
+  [[nodiscard]] float getValueAt(float phase) const noexcept;
+
+  void compileTo(Table&) const noexcept;
+
+  bool operator==(const CustomLfoShape&) const = default;
+
+private:
+  std::vector<Breakpoint> breakpoints;
+};
+}  // namespace tremolo
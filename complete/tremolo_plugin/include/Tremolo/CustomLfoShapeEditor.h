@@ -0,0 +1,49 @@
+#pragma once
+
+namespace tremolo {
+/** Lets the user draw the custom LFO shape over one LFO period.
+ *
+ * Click to add a breakpoint, drag to move it, and double-click to remove it.
+ * The background is transparent, so the component can lie over the LFO
+ * visualizer.
+ */
+class CustomLfoShapeEditor : public juce::Component {
+public:
+  using OnShapeChanged = std::function<void(const CustomLfoShape&)>;
+
+  explicit CustomLfoShapeEditor(OnShapeChanged);
+
+  /** @brief Displays the shape without calling the callback */
+  void setShape(CustomLfoShape);
+  [[nodiscard]] const CustomLfoShape& getShape() const noexcept;
+
+  void setCurveColor(juce::Colour);
+
+  void paint(juce::Graphics&) override;
+  void mouseDown(const juce::MouseEvent&) override;
+  void mouseDrag(const juce::MouseEvent&) override;
+  void mouseUp(const juce::MouseEvent&) override;
+  void mouseDoubleClick(const juce::MouseEvent&) override;
+
+private:
+  [[nodiscard]] juce::Point<float> toPosition(
+      CustomLfoShape::Breakpoint) const noexcept;
+  [[nodiscard]] CustomLfoShape::Breakpoint toBreakpoint(
+      juce::Point<float> position) const noexcept;
+  [[nodiscard]] std::optional<size_t> findBreakpointAt(
+      juce::Point<float> position) const noexcept;
+
+  void changeShape(std::vector<CustomLfoShape::Breakpoint>);
+
+  static constexpr auto breakpointRadius = 4.f;
+  // the same vertical range as the LFO visualizer's
+  static constexpr auto valueLimit = 1.1f;
+
+  CustomLfoShape shape;
+  OnShapeChanged onShapeChanged;
+  juce::Colour curveColor{juce::Colours::white};
+  std::optional<CustomLfoShape::Breakpoint> draggedBreakpoint;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CustomLfoShapeEditor)
+};
+}  // namespace tremolo
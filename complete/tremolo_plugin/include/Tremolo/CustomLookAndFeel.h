@@ -5,15 +5,23 @@ class CustomLookAndFeel : public juce::LookAndFeel_V4 {
 public:
   enum class Colors : size_t { orange, paleBlue };
 
+  enum class KnobRenderingMode {
+    /** Static knob layers are cached, the value arc is drawn on each paint */
+    layered,
+    /** The whole knob is drawn as a frame of a filmstrip pre-rendered on a
+     * background thread for each size and scale factor in use */
+    filmstrip,
+  };
+
   static juce::Colour getColor(Colors colorName);
 
   CustomLookAndFeel();
 
-  [[nodiscard]] static juce::FontOptions getSideLabelsFont();
+  [[nodiscard]] juce::FontOptions getSideLabelsFont() const;
 
   juce::BorderSize<int> getLabelBorderSize(juce::Label&) override;
 
-  [[nodiscard]] static juce::FontOptions getRateLabelFont();
+  [[nodiscard]] juce::FontOptions getRateLabelFont() const;
 
   void drawRotarySlider(juce::Graphics&,
                         int x,
@@ -25,6 +33,8 @@ public:
                         float rotaryEndAngle,
                         juce::Slider&) override;
 
+  void setKnobRenderingMode(KnobRenderingMode);
+
   void drawComboBox(juce::Graphics&,
                     int width,
                     int height,
@@ -55,7 +65,62 @@ public:
                         bool shouldDrawButtonAsDown) override;
 
 private:
-  [[nodiscard]] static juce::FontOptions interMedium();
-  [[nodiscard]] static juce::FontOptions interBold();
+  enum class Layer {
+    knobCanal,
+    knobBody,
+    comboBox,
+    toggleButtonOff,
+    toggleButtonOn,
+  };
+
+  struct KnobFilmstripKey {
+    float width;
+    float height;
+    float scale;
+    float rotaryStartAngle;
+    float rotaryEndAngle;
+
+    [[nodiscard]] bool operator==(const KnobFilmstripKey&) const noexcept;
+  };
+
+  struct KnobFilmstrip {
+    KnobFilmstripKey key;
+    /** invalid while the filmstrip renders in the background */
+    juce::Image image;
+    /** the sliders drawn with this filmstrip or waiting for it */
+    std::vector<juce::Component::SafePointer<juce::Slider>> sliders;
+  };
+
+  static constexpr auto knobFilmstripFrameCount = 64;
+
+  static void drawKnobFilmstripFrame(juce::Graphics&,
+                                     const KnobFilmstrip&,
+                                     const juce::Rectangle<float>& bounds,
+                                     float sliderPos);
+
+  /** @return the filmstrip of the key, requested from the background
+   * renderer if the key is new */
+  KnobFilmstrip& getKnobFilmstrip(const KnobFilmstripKey&, juce::Slider&);
+
+  /** @brief Forgets that the slider draws with any filmstrip and drops the
+   * filmstrips no living slider draws with */
+  void releaseKnobFilmstrips(const juce::Slider&);
+
+  void requestKnobFilmstrip(const KnobFilmstripKey&);
+
+  [[nodiscard]] juce::FontOptions interMedium() const;
+  [[nodiscard]] juce::FontOptions interBold() const;
+
+  juce::Typeface::Ptr interMediumTypeface;
+  juce::Typeface::Ptr interBoldTypeface;
+  detail::LayerCache<Layer> layerCache;
+
+  KnobRenderingMode knobRenderingMode{KnobRenderingMode::layered};
+  // one per size and scale factor in use, e.g., by two editors at different
+  // scale factors
+  std::vector<KnobFilmstrip> knobFilmstrips;
+
+  // declared last to drop pending callbacks before other members are destroyed
+  BackgroundRenderer backgroundRenderer;
 };
 }  // namespace tremolo
@@ -0,0 +1,130 @@
+#pragma once
+
+namespace tremolo {
+/** A peak envelope follower with separate attack and release times,
+ * reporting the level averaged over all channels.
+ *
+ * Like in LinkwitzRileyCrossover, the detector state of several channels is
+ * stored in one SIMD register, and the channels are followed together in its
+ * lanes. Without SIMD support, each channel group holds a single channel.
+ */
+class EnvelopeFollower {
+public:
+#if JUCE_USE_SIMD
+  using Lanes = juce::dsp::SIMDRegister<float>;
+  static constexpr auto laneCount = Lanes::SIMDNumElements;
+#else
+  using Lanes = float;
+  static constexpr auto laneCount = 1uz;
+#endif
+
+  void prepare(double sampleRate, int channelCount) {
+    attackCoefficient = smoothingCoefficient(sampleRate, attackTimeSeconds);
+    releaseCoefficient = smoothingCoefficient(sampleRate, releaseTimeSeconds);
+    envelopes.resize(
+        (static_cast<size_t>(channelCount) + laneCount - 1uz) / laneCount);
+    reset();
+  }
+
+  void reset() noexcept { std::ranges::fill(envelopes, Lanes{}); }
+
+  /** @brief Follows the frames starting at startFrame and writes their
+   * levels, averaged over the channels, to the output.
+   *
+   * The channels are followed one group at a time through the whole block.
+   */
+  void process(const float* const* channels,
+               size_t channelCount,
+               int startFrame,
+               std::span<float> levels) noexcept {
+    jassert(channelCount <= envelopes.size() * laneCount);
+
+    std::ranges::fill(levels, 0.f);
+    if (channelCount == 0uz) {
+      return;
+    }
+
+    const auto channelWeight = 1.f / static_cast<float>(channelCount);
+
+    for (const auto groupIndex : std::views::iota(0uz, envelopes.size())) {
+      const auto firstChannel = groupIndex * laneCount;
+      if (firstChannel >= channelCount) {
+        break;
+      }
+      const auto groupChannelCount =
+          std::min(laneCount, channelCount - firstChannel);
+
+      auto envelope = envelopes[groupIndex];
+      // unused lanes stay at zero and don't add to the level
+      alignas(Lanes) std::array<float, laneCount> frame{};
+
+      for (const auto i : std::views::iota(0uz, levels.size())) {
+        const auto frameIndex = startFrame + static_cast<int>(i);
+        for (const auto lane : std::views::iota(0uz, groupChannelCount)) {
+          frame[lane] = channels[firstChannel + lane][frameIndex];
+        }
+
+        const auto rectified = absolute(load(frame));
+        const auto coefficient = choose(rectified, envelope);
+        envelope = rectified + coefficient * (envelope - rectified);
+
+        levels[i] += channelWeight * sum(envelope);
+      }
+
+      envelopes[groupIndex] = envelope;
+    }
+  }
+
+private:
+  static constexpr auto attackTimeSeconds = 0.01;
+  static constexpr auto releaseTimeSeconds = 0.2;
+
+  /** @return the one-pole coefficient reaching 1 - 1/e of a step in the
+   * given time */
+  static float smoothingCoefficient(double sampleRate,
+                                    double timeSeconds) noexcept {
+    return static_cast<float>(std::exp(-1.0 / (timeSeconds * sampleRate)));
+  }
+
+  static Lanes load(const std::array<float, laneCount>& frame) noexcept {
+#if JUCE_USE_SIMD
+    return Lanes::fromRawArray(frame.data());
+#else
+    return frame[0];
+#endif
+  }
+
+  static Lanes absolute(Lanes lanes) noexcept {
+#if JUCE_USE_SIMD
+    return Lanes::abs(lanes);
+#else
+    return std::abs(lanes);
+#endif
+  }
+
+  static float sum(Lanes lanes) noexcept {
+#if JUCE_USE_SIMD
+    return lanes.sum();
+#else
+    return lanes;
+#endif
+  }
+
+  /** @return the attack coefficient in the lanes where the input rises above
+   * the envelope and the release coefficient in the others, without
+   * branching */
+  [[nodiscard]] Lanes choose(Lanes rectified, Lanes envelope) const noexcept {
+#if JUCE_USE_SIMD
+    const auto rising = Lanes::greaterThan(rectified, envelope);
+    return (Lanes::expand(attackCoefficient) & rising) +
+           (Lanes::expand(releaseCoefficient) & ~rising);
+#else
+    return rectified > envelope ? attackCoefficient : releaseCoefficient;
+#endif
+  }
+
+  float attackCoefficient{0.f};
+  float releaseCoefficient{0.f};
+  std::vector<Lanes> envelopes;
+};
+}  // namespace tremolo
@@ -6,7 +6,9 @@ public:
   static void serialize(const Parameters&, juce::OutputStream&);
 
   /** @return Error message on failure; empty string otherwise.
-   *           In case of error, no parameters are updated. */
+   *           In case of error, no parameters are updated. Parameters
+   *           that the JSON state doesn't store are reset to their
+   *           defaults. */
   static juce::Result deserialize(juce::InputStream&, Parameters&);
 };
 }  // namespace tremolo
@@ -6,10 +6,23 @@ public:
   using ReadAllLfoSamples = std::function<void(juce::AudioBuffer<float>&)>;
   using GetCurrentSampleRate = std::function<double()>;
   using IsBypassed = std::function<bool()>;
+  using RenderBackdrop = std::function<juce::Image(float scaleFactor)>;
+  /** returns the LFO rate or nothing if the waveform has edges */
+  using GetModulationRateHz = std::function<std::optional<float>()>;
+
+  /** Selects how the LFO curve gets rasterized */
+  enum class CurveRenderer {
+    /** strokes a juce::Path through all plotted points */
+    pathStroke,
+    /** fills one vertical span per physical pixel column, spanning the values
+     * plotted in that column; much cheaper for the software renderer */
+    scanline,
+  };
 
   LfoVisualizer(ReadAllLfoSamples readSamples,
                 GetCurrentSampleRate getRate,
-                IsBypassed getIsBypassed);
+                IsBypassed getIsBypassed,
+                CurveRenderer renderer = CurveRenderer::pathStroke);
 
   void paint(juce::Graphics& g) override;
 
@@ -18,13 +31,69 @@ public:
 
   void setBackgroundColor(juce::Colour c);
 
+  /** @brief Enables the compositing mode.
+   *
+   * In this mode, the visualizer paints a cached backdrop instead of the
+   * background color and is opaque. Thus, its repaints at the display rate
+   * don't repaint the components underneath.
+   *
+   * @param render callback rendering what lies behind the visualizer at the
+   *               given display scale factor, e.g., a snapshot of the
+   *               underlying components; pass nullptr to disable the mode
+   */
+  void setBackdrop(RenderBackdrop render);
+
+  /** @brief Re-renders the backdrop on next paint, e.g., when the components
+   * underneath changed */
+  void invalidateBackdrop();
+
+  /** @brief Enables the adaptive frame pacing.
+   *
+   * The curve gets rebuilt and repainted only after it moved by at least the
+   * given fraction of a pixel, which takes longer the slower the LFO is.
+   * Edges, e.g., of the square, jump across the plot at any rate; thus,
+   * waveforms with edges are repainted at maxFrameRate. The LFO samples are
+   * still read on every vertical blank.
+   *
+   * @param getModulationRate callback returning the rate the LFO runs at,
+   *                          e.g., the one derived from the host's tempo, or
+   *                          nothing if the waveform has edges; pass nullptr
+   *                          to repaint on every vertical blank
+   * @param minPixelShift curve movement that triggers a repaint, in pixels
+   * @param maxFrameRate hard cap on the repaint rate in Hz
+   */
+  void setFramePacing(GetModulationRateHz getModulationRate,
+                      float minPixelShift = 0.5f,
+                      double maxFrameRate = 60.0);
+
+  /** @return the time between repaints of the curve; 0 if repainting on every
+   * vertical blank */
+  [[nodiscard]] double getFrameIntervalSeconds() const;
+
+  /** @brief Reads new LFO samples and rebuilds the curve; called on every
+   * vertical blank.
+   *
+   * Rebuilding and repainting may be skipped; see setFramePacing().
+   *
+   * After the first few calls, it reuses the already allocated sample buffer
+   * and path storage, so it does not allocate unless the sample rate grows.
+   */
+  void update(double timestampSeconds);
+
 private:
   static constexpr auto pointsOnPath = 22050u;
   static constexpr auto periodsToPlotOf1HzWaveform = 4u;
+  static constexpr auto curveYLimit = 1.1f;
 
-  void update(double timestampSeconds);
+  /** @brief Grows the buffer to hold all samples the LFO sample FIFO can
+   * return, i.e., a second of audio */
+  void reserveBufferCapacity();
+
+  [[nodiscard]] bool isFrameDue(double timestampSeconds) const;
 
-  void updateLfoCurve(double timestampSeconds);
+  /** @return the fastest vertical movement of the curve in pixels per
+   * second or nothing if the curve has edges */
+  [[nodiscard]] std::optional<double> getCurvePixelsPerSecond() const;
 
   void updateSamplesQueue(double timestampSeconds);
 
@@ -43,18 +112,34 @@ private:
    */
   [[nodiscard]] juce::AffineTransform getLfoCurveTransform() const;
 
+  void paintBackground(juce::Graphics& g);
+
+  void strokeCurve(juce::Graphics& g);
+
+  void plotCurveAsScanlines(juce::Graphics& g);
+
   float curveWidth{4.f};
   juce::Colour curveColor{juce::Colours::black};
   juce::Colour backgroundColour{juce::Colours::white};
   ReadAllLfoSamples readAllLfoSamples;
   GetCurrentSampleRate getCurrentSampleRate;
   IsBypassed isBypassed;
+  CurveRenderer curveRenderer;
+  RenderBackdrop renderBackdrop;
+  GetModulationRateHz getModulationRateHz;
+  float framePacingPixelShift{0.5f};
+  double maxFrameRateHz{60.0};
+  juce::Image backdrop;
+  float backdropScale{0.f};
+  juce::Rectangle<int> backdropBounds;
   juce::AudioBuffer<float> buffer;
+  int bufferCapacity{0};
   juce::Path lfoCurve;
 
   detail::StridedQueue<float, pointsOnPath> lfoSamplesToPlot;
 
   std::optional<double> lastTimestampSeconds;
+  std::optional<double> lastFrameTimestampSeconds;
   juce::VBlankAttachment vblankAttachment{
       this, [this](double timestampSeconds) { update(timestampSeconds); }};
 };
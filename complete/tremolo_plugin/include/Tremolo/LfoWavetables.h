@@ -0,0 +1,53 @@
+#pragma once
+
+namespace tremolo {
+/** Band-limited, mip-mapped wavetables of all LFO waveforms.
+ *
+ * The tables don't depend on the sample rate, so all plugin instances share
+ * them: access them through juce::SharedResourcePointer<LfoWavetables>. The
+ * constructor sums the Fourier series of each waveform using a single sine
+ * table, so it computes no transcendental functions per harmonic.
+ *
+ * Mip level k holds the first (maxHarmonicCount >> k) harmonics. Each table
+ * is normalized to a peak of 1 and starts at 0 like the sine.
+ */
+class LfoWavetables {
+public:
+  enum class Waveform : size_t {
+    sine = 0,
+    triangle = 1,
+    square = 2,
+    sawUp = 3,
+    sawDown = 4,
+    smoothedPulse = 5,
+    /** drawn by the user and compiled to a table of its own; see
+     * CustomLfoShape */
+    custom = 6,
+  };
+
+  /** the number of waveforms with tables here, i.e., all but the custom one */
+  static constexpr auto waveformCount = 6uz;
+  static constexpr auto tableSize = 1024uz;
+  static constexpr auto maxHarmonicCount = tableSize / 2uz;
+  /** 512, 256, ..., 1 harmonics */
+  static constexpr auto mipLevelCount = 10uz;
+
+  LfoWavetables();
+
+  /** @return one period of tableSize samples followed by the first sample
+   * repeated, so that interpolation needs no wrap-around */
+  [[nodiscard]] std::span<const float> getTable(
+      Waveform,
+      size_t mipLevel) const noexcept;
+
+  /** @return the level with the most harmonics that all stay below the
+   * Nyquist frequency */
+  [[nodiscard]] static size_t getMipLevel(float frequencyHz,
+                                          double sampleRate) noexcept;
+
+private:
+  std::vector<float> tables;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LfoWavetables)
+};
+}  // namespace tremolo
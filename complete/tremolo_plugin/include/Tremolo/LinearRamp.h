@@ -0,0 +1,115 @@
+#pragma once
+
+namespace tremolo {
+/** A linearly smoothed value advanced a block at a time.
+ *
+ * The interface follows juce::LinearSmoothedValue, but instead of stepping
+ * the value per sample, the block methods compute sample i of a ramp as
+ * start + (i + 1) * increment, which the compiler vectorizes, and advance the
+ * ramp once per block. Thus, a ramping value costs as much as a constant one.
+ */
+class LinearRamp {
+public:
+  explicit LinearRamp(float initialValue = 0.f) noexcept
+      : current{initialValue}, target{initialValue} {}
+
+  void reset(double sampleRate, double rampLengthSeconds) noexcept {
+    jassert(0.0 <= sampleRate && 0.0 <= rampLengthSeconds);
+
+    stepCount = static_cast<size_t>(std::floor(rampLengthSeconds * sampleRate));
+    setCurrentAndTargetValue(target);
+  }
+
+  void setCurrentAndTargetValue(float newValue) noexcept {
+    current = target = newValue;
+    remainingSteps = 0uz;
+    increment = 0.f;
+  }
+
+  void setTargetValue(float newTarget) noexcept {
+    if (juce::exactlyEqual(newTarget, target)) {
+      return;
+    }
+
+    if (stepCount == 0uz) {
+      setCurrentAndTargetValue(newTarget);
+      return;
+    }
+
+    target = newTarget;
+    remainingSteps = stepCount;
+    increment = (target - current) / static_cast<float>(remainingSteps);
+  }
+
+  [[nodiscard]] float getCurrentValue() const noexcept { return current; }
+  [[nodiscard]] float getTargetValue() const noexcept { return target; }
+  [[nodiscard]] bool isSmoothing() const noexcept {
+    return remainingSteps > 0uz;
+  }
+
+  /** @brief Writes the next values to the output and advances the ramp */
+  void fill(std::span<float> output) noexcept {
+    const auto rampLength = std::min(remainingSteps, output.size());
+    for (const auto i : std::views::iota(0uz, rampLength)) {
+      output[i] = valueAfter(i + 1uz);
+    }
+    std::ranges::fill(output.subspan(rampLength), target);
+
+    advance(output.size());
+  }
+
+  /** @brief Multiplies the samples by the next values and advances the
+   * ramp */
+  void multiply(std::span<float> samples) noexcept {
+    const auto rampLength = std::min(remainingSteps, samples.size());
+    for (const auto i : std::views::iota(0uz, rampLength)) {
+      samples[i] *= valueAfter(i + 1uz);
+    }
+    juce::FloatVectorOperations::multiply(
+        samples.data() + rampLength, target,
+        static_cast<int>(samples.size() - rampLength));
+
+    advance(samples.size());
+  }
+
+  /** @brief Applies the next values as gain to all channels of the buffer
+   * and advances the ramp */
+  void applyGain(juce::AudioBuffer<float>& buffer, int sampleCount) noexcept {
+    const auto sampleCountToApply = static_cast<size_t>(sampleCount);
+    const auto rampLength = std::min(remainingSteps, sampleCountToApply);
+
+    for (const auto channel : std::views::iota(0, buffer.getNumChannels())) {
+      auto* const samples = buffer.getWritePointer(channel);
+      for (const auto i : std::views::iota(0uz, rampLength)) {
+        samples[i] *= valueAfter(i + 1uz);
+      }
+      juce::FloatVectorOperations::multiply(
+          samples + rampLength, target,
+          static_cast<int>(sampleCountToApply - rampLength));
+    }
+
+    advance(sampleCountToApply);
+  }
+
+private:
+  [[nodiscard]] float valueAfter(size_t steps) const noexcept {
+    return current + static_cast<float>(steps) * increment;
+  }
+
+  void advance(size_t steps) noexcept {
+    if (steps >= remainingSteps) {
+      setCurrentAndTargetValue(target);
+      return;
+    }
+
+    current = valueAfter(steps);
+    remainingSteps -= steps;
+  }
+
+  float current;
+  float target;
+  float increment{0.f};
+  size_t stepCount{0uz};
+  size_t remainingSteps{0uz};
+};
+}  // namespace tremolo
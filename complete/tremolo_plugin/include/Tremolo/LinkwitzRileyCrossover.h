@@ -0,0 +1,153 @@
+#pragma once
+
+namespace tremolo {
+/** A 4th-order Linkwitz-Riley crossover splitting each channel into a low and
+ * a high band, which sum up to an all-pass filtered input.
+ *
+ * Each band is a cascade of two 2nd-order Butterworth biquads. The biquad
+ * state of several channels is stored in one SIMD register, and the channels
+ * are filtered together in its lanes; thus, a stereo instance costs as much
+ * as a mono one. Without SIMD support, each channel group holds a single
+ * channel.
+ */
+class LinkwitzRileyCrossover {
+public:
+#if JUCE_USE_SIMD
+  using Lanes = juce::dsp::SIMDRegister<float>;
+  static constexpr auto laneCount = Lanes::SIMDNumElements;
+#else
+  using Lanes = float;
+  static constexpr auto laneCount = 1uz;
+#endif
+
+  void prepare(double newSampleRate, int channelCount) {
+    sampleRate = newSampleRate;
+    channelGroups.resize(
+        (static_cast<size_t>(channelCount) + laneCount - 1uz) / laneCount);
+    setCutoffFrequency(cutoffFrequencyHz);
+    reset();
+  }
+
+  void reset() noexcept {
+    for (auto& group : channelGroups) {
+      group = {};
+    }
+  }
+
+  void setCutoffFrequency(float frequencyHz) noexcept {
+    cutoffFrequencyHz = frequencyHz;
+
+    // Butterworth biquads from the Audio EQ Cookbook with Q = 1/sqrt(2)
+    const auto w0 = juce::MathConstants<double>::twoPi *
+                    static_cast<double>(frequencyHz) / sampleRate;
+    const auto cosW0 = std::cos(w0);
+    const auto alpha = std::sin(w0) / juce::MathConstants<double>::sqrt2;
+    const auto a0 = 1.0 + alpha;
+    const auto a1 = static_cast<float>(-2.0 * cosW0 / a0);
+    const auto a2 = static_cast<float>((1.0 - alpha) / a0);
+
+    const auto lowB0 = static_cast<float>((1.0 - cosW0) / 2.0 / a0);
+    lowpassCoefficients = {lowB0, 2.f * lowB0, lowB0, a1, a2};
+
+    const auto highB0 = static_cast<float>((1.0 + cosW0) / 2.0 / a0);
+    highpassCoefficients = {highB0, -2.f * highB0, highB0, a1, a2};
+  }
+
+  /** @brief Splits the first sampleCount frames of the buffer into bands and
+   * replaces them with what combine(frameIndex, input, low, high) returns.
+   *
+   * combine() receives and returns the samples of up to laneCount channels
+   * as Lanes.
+   */
+  template <typename Combine>
+  void process(juce::AudioBuffer<float>& buffer,
+               int sampleCount,
+               Combine&& combine) noexcept {
+    const auto channelCount = static_cast<size_t>(buffer.getNumChannels());
+    jassert(channelCount <= channelGroups.size() * laneCount);
+
+    auto* const* const channels = buffer.getArrayOfWritePointers();
+
+    for (const auto groupIndex : std::views::iota(0uz, channelGroups.size())) {
+      auto& group = channelGroups[groupIndex];
+      const auto firstChannel = groupIndex * laneCount;
+      if (firstChannel >= channelCount) {
+        break;
+      }
+      const auto groupChannelCount =
+          std::min(laneCount, channelCount - firstChannel);
+
+      alignas(Lanes) std::array<float, laneCount> frame{};
+
+      for (const auto frameIndex : std::views::iota(0, sampleCount)) {
+        for (const auto lane : std::views::iota(0uz, groupChannelCount)) {
+          frame[lane] = channels[firstChannel + lane][frameIndex];
+        }
+
+        const auto input = load(frame);
+        const auto low = group.lowpass[1].process(
+            group.lowpass[0].process(input, lowpassCoefficients),
+            lowpassCoefficients);
+        const auto high = group.highpass[1].process(
+            group.highpass[0].process(input, highpassCoefficients),
+            highpassCoefficients);
+
+        store(combine(frameIndex, input, low, high), frame);
+
+        for (const auto lane : std::views::iota(0uz, groupChannelCount)) {
+          channels[firstChannel + lane][frameIndex] = frame[lane];
+        }
+      }
+    }
+  }
+
+private:
+  struct Coefficients {
+    float b0{1.f};
+    float b1{0.f};
+    float b2{0.f};
+    float a1{0.f};
+    float a2{0.f};
+  };
+
+  /** Transposed direct form II */
+  struct Biquad {
+    Lanes process(Lanes x, const Coefficients& c) noexcept {
+      const auto y = x * c.b0 + z1;
+      z1 = x * c.b1 - y * c.a1 + z2;
+      z2 = x * c.b2 - y * c.a2;
+      return y;
+    }
+
+    Lanes z1{};
+    Lanes z2{};
+  };
+
+  struct ChannelGroup {
+    std::array<Biquad, 2u> lowpass{};
+    std::array<Biquad, 2u> highpass{};
+  };
+
+  static Lanes load(const std::array<float, laneCount>& frame) noexcept {
+#if JUCE_USE_SIMD
+    return Lanes::fromRawArray(frame.data());
+#else
+    return frame[0];
+#endif
+  }
+
+  static void store(Lanes lanes, std::array<float, laneCount>& frame) noexcept {
+#if JUCE_USE_SIMD
+    lanes.copyToRawArray(frame.data());
+#else
+    frame[0] = lanes;
+#endif
+  }
+
+  double sampleRate{44100.0};
+  float cutoffFrequencyHz{800.f};
+  Coefficients lowpassCoefficients;
+  Coefficients highpassCoefficients;
+  std::vector<ChannelGroup> channelGroups;
+};
+}  // namespace tremolo
@@ -9,9 +9,6 @@ public:
       : parent{topLevelComponent},
         target{clickTarget},
         message{std::move(messageOnClick)} {
-    popup.setAllowedPlacement(juce::BubbleComponent::BubblePlacement::below);
-    popup.setAlwaysOnTop(true);
-
     message.setColour(
         CustomLookAndFeel::getColor(CustomLookAndFeel::Colors::paleBlue));
     message.setJustification(juce::Justification::centred);
@@ -25,18 +22,23 @@ public:
 
 private:
   void displayPopup() {
-    // only the first call to addChildComponent() has an effect
-    parent.addChildComponent(popup);
+    // created on first use to keep the editor construction fast
+    if (popup == nullptr) {
+      popup = std::make_unique<juce::BubbleMessageComponent>();
+      popup->setAllowedPlacement(juce::BubbleComponent::BubblePlacement::below);
+      popup->setAlwaysOnTop(true);
+      parent.addChildComponent(*popup);
+    }
 
-    if (!popup.isVisible()) {
-      popup.showAt(&target, message, 0, true);
+    if (!popup->isVisible()) {
+      popup->showAt(&target, message, 0, true);
     }
   }
 
   juce::Component& parent;
   juce::Component& target;
   juce::AttributedString message;
-  juce::BubbleMessageComponent popup;
+  std::unique_ptr<juce::BubbleMessageComponent> popup;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MessageOnClick)
 };
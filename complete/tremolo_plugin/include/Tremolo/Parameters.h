@@ -1,12 +1,115 @@
 #pragma once
 
 namespace tremolo {
-struct Parameters {
+/** Values of all parameters as of the same moment */
+struct ParameterSnapshot {
+  float rate{0.f};
+  bool bypassed{false};
+  int waveformIndex{0};
+  float morph{0.f};
+  float depth{0.f};
+  float mix{0.f};
+  int tempoSyncIndex{0};
+  bool harmonic{false};
+  bool dynamicDepth{false};
+  /** changes whenever any of the parameters changes */
+  juce::uint32 generation{0u};
+};
+
+/** The plugin's parameters and a snapshot of their values.
+ *
+ * Any thread may change the parameters: the message thread, e.g., through the
+ * editor or when loading a state, and the host's threads, including the audio
+ * thread when the host delivers automation. Publishing the snapshot never
+ * blocks, so a change on the audio thread doesn't wait for other writers.
+ */
+struct Parameters : private juce::AudioProcessorParameter::Listener {
   explicit Parameters(juce::AudioProcessor&);
+  ~Parameters() override;
 
   juce::AudioParameterFloat& rate;
   juce::AudioParameterBool& bypassed;
   juce::AudioParameterChoice& waveform;
+  /** modulates the low and the high band in opposite phase */
+  juce::AudioParameterBool& harmonic;
+  /** makes the modulation depth follow the input level */
+  juce::AudioParameterBool& dynamicDepth;
+  /** blends the waveform with the next one in the list */
+  juce::AudioParameterFloat& morph;
+  juce::AudioParameterFloat& depth;
+  /** the share of the processed signal in the output */
+  juce::AudioParameterFloat& mix;
+  /** "Off" or a note division to sync the LFO to; see TempoSync */
+  juce::AudioParameterChoice& tempoSync;
+
+  /** @brief Reads all parameters at once without locking or waiting.
+   *
+   * Call it once per block on the audio thread to get a coherent view of
+   * the parameters, even if they change from another thread mid-block.
+   *
+   * @return nothing if writers kept storing values during
+   * maxSnapshotReadAttempts attempts; keep using the previous snapshot then
+   */
+  [[nodiscard]] std::optional<ParameterSnapshot> tryGetSnapshot()
+      const noexcept;
+
+  /** @brief Reads all parameters at once, yielding while writers store
+   * values; don't call it on the audio thread */
+  [[nodiscard]] ParameterSnapshot getSnapshot() const noexcept;
+
+  /** Publishes the changes of several parameters as a single snapshot when
+   * destroyed, e.g., when loading a state */
+  class ScopedBatchUpdate {
+  public:
+    explicit ScopedBatchUpdate(Parameters& p) noexcept;
+    ~ScopedBatchUpdate() noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE(ScopedBatchUpdate)
+    JUCE_DECLARE_NON_MOVEABLE(ScopedBatchUpdate)
+
+  private:
+    Parameters& parameters;
+  };
+
+private:
+  static constexpr auto maxSnapshotReadAttempts = 16;
+
+  void parameterValueChanged(int parameterIndex, float newValue) override;
+  void parameterGestureChanged(int parameterIndex,
+                               bool gestureIsStarting) override;
+
+  /** @brief Stores the current parameter values as the snapshot.
+   *
+   * A seqlock: the sequence number is odd while the values are written, and
+   * readers retry if it changed while they read.
+   */
+  void publishSnapshot() noexcept;
+
+  /** @brief Stores the snapshot even during a batch update.
+   *
+   * Doesn't wait if another writer is storing it; that writer stores it
+   * once more with this change instead.
+   */
+  void storeSnapshot() noexcept;
+
+  /** @brief Writes the values; call it with publishLock held */
+  void storeSnapshotValues() noexcept;
+
+  // taken with a try-lock only; see storeSnapshot()
+  juce::SpinLock publishLock;
+  // set by writers that changed a value since the last store
+  std::atomic<bool> snapshotDirty{false};
+  std::atomic<juce::uint32> sequence{0u};
+  std::atomic<float> snapshotRate{0.f};
+  std::atomic<bool> snapshotBypassed{false};
+  std::atomic<int> snapshotWaveformIndex{0};
+  std::atomic<float> snapshotMorph{0.f};
+  std::atomic<float> snapshotDepth{0.f};
+  std::atomic<float> snapshotMix{0.f};
+  std::atomic<int> snapshotTempoSyncIndex{0};
+  std::atomic<bool> snapshotHarmonic{false};
+  std::atomic<bool> snapshotDynamicDepth{false};
+  std::atomic<int> batchUpdateDepth{0};
 
   JUCE_DECLARE_NON_COPYABLE(Parameters)
   JUCE_DECLARE_NON_MOVEABLE(Parameters)
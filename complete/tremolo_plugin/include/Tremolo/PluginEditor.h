@@ -1,34 +1,66 @@
 #pragma once
 
 namespace tremolo {
-class PluginEditor : public juce::AudioProcessorEditor {
+class PluginEditor : public juce::AudioProcessorEditor,
+                     private juce::ChangeListener {
 public:
   explicit PluginEditor(PluginProcessor&);
   ~PluginEditor() override;
 
+  /** Paints a placeholder visible until the background image is decoded */
+  void paint(juce::Graphics&) override;
   void resized() override;
 
 private:
-  juce::ImageComponent background;
-  juce::ImageComponent logo;
+  void changeListenerCallback(juce::ChangeBroadcaster*) override;
+
+  void updateImages();
+  void updateCustomLfoShapeEditorVisibility();
+
+  [[nodiscard]] juce::Image renderLfoVisualizerBackdrop(float scaleFactor);
+
+  PluginProcessor& pluginProcessor;
+
+  // declared first to outlive the components using the shared look-and-feel
+  juce::SharedResourcePointer<SharedResources> sharedResources;
+  CustomLookAndFeel& lookAndFeel{sharedResources->getLookAndFeel()};
+
+  PrescaledImageComponent background{sharedResources->getScaledImageCache()};
+  PrescaledImageComponent logo{sharedResources->getScaledImageCache()};
 
   juce::Label waveformLabel{"waveform label", "WAVEFORM"};
   juce::ComboBox waveformComboBox;
   juce::ComboBoxParameterAttachment waveformAttachment;
 
+  juce::Slider morphSlider;
+  juce::SliderParameterAttachment morphAttachment;
+
+  juce::ToggleButton harmonicButton{"Harmonic"};
+  juce::ButtonParameterAttachment harmonicAttachment;
+
+  juce::ToggleButton dynamicDepthButton{"Dynamic depth"};
+  juce::ButtonParameterAttachment dynamicDepthAttachment;
+
   juce::Label rateLabel{"rate label", "RATE"};
   juce::Slider rateSlider;
   juce::SliderParameterAttachment rateAttachment;
 
+  juce::ComboBox tempoSyncComboBox;
+  juce::ComboBoxParameterAttachment tempoSyncAttachment;
+
+  juce::Slider depthSlider;
+  juce::SliderParameterAttachment depthAttachment;
+  juce::Slider mixSlider;
+  juce::SliderParameterAttachment mixAttachment;
+
   juce::Label bypassLabel{"bypass label", "BYPASS"};
   juce::ToggleButton bypassButton{"BYPASSED"};
   juce::ButtonParameterAttachment bypassAttachment;
 
   LfoVisualizer lfoVisualizer;
+  CustomLfoShapeEditor customLfoShapeEditor;
   MessageOnClick about;
 
-  CustomLookAndFeel lookAndFeel;
-
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginEditor)
 };
 }  // namespace tremolo
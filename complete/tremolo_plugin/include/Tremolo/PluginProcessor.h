@@ -3,7 +3,11 @@
 namespace tremolo {
 class PluginProcessor : public juce::AudioProcessor {
 public:
+  /** of the main bus; the input and the output layouts must match */
+  static constexpr auto maxChannelCount = 64;
+
   PluginProcessor();
+  ~PluginProcessor() override;
 
   void prepareToPlay(double sampleRate, int expectedMaxFramesPerBlock) override;
 
@@ -42,11 +46,67 @@ public:
    * in a thread-safe manner */
   double getSampleRateThreadSafe() const noexcept;
 
+  /** @brief Retrieves the rate the LFO ran at in the most recent block, e.g.,
+   * the one derived from the host's tempo, in a thread-safe manner */
+  float getModulationRateHzThreadSafe() const noexcept;
+
+  /** @brief Replaces the shape of the custom LFO waveform.
+   *
+   * The shape is compiled to a table in the background; the audio thread
+   * picks the table up at the start of a block.
+   */
+  void setCustomLfoShape(CustomLfoShape);
+  [[nodiscard]] CustomLfoShape getCustomLfoShape() const;
+
+  /** Sends a change message when loading a state replaces the custom LFO
+   * shape */
+  [[nodiscard]] juce::ChangeBroadcaster& getCustomLfoShapeLoadedBroadcaster()
+      noexcept;
+
 private:
+  /** Parameter values to apply without smoothing, e.g., after loading a
+   * state */
+  struct ForceParametersCommand {
+    float rate;
+    bool bypassed;
+    int waveformIndex;
+    bool harmonic;
+    bool dynamicDepth;
+    float morph;
+    float depth;
+    float mix;
+  };
+
+  void applyPendingCommands() noexcept;
+  void syncLfoToPlayHead(int tempoSyncIndex) noexcept;
+  void compileCustomLfoShape(CustomLfoShape);
+
+  // starts decoding the editor's images ahead of the first editor opening;
+  // its thread also compiles the custom LFO shapes
+  juce::SharedResourcePointer<SharedResources> sharedResources;
   Parameters parameters{*this};
   Tremolo tremolo;
   BypassTransitionSmoother bypassTransitionSmoother;
   std::atomic<double> currentSampleRate{0.};
+  std::atomic<float> currentModulationRateHz{0.f};
+  // audio thread only; the DSP objects are updated only when it changes
+  std::optional<juce::uint32> appliedParametersGeneration;
+  // audio thread only; reused while writers keep the snapshot busy
+  ParameterSnapshot parameterSnapshot;
+  // audio thread only; whether the last block was bypassed and not fading
+  bool wasBypassedAndNotTransitioning{false};
+  // audio thread only; the first synced phase is set without a glide
+  bool lfoPhaseSyncedSincePrepare{false};
+  // from the message thread to the audio thread, applied at block boundaries;
+  // only the latest loaded state matters
+  detail::LatestValue<ForceParametersCommand> forcedParameters;
+
+  // getStateInformation() may be called on any thread
+  juce::CriticalSection customLfoShapeLock;
+  CustomLfoShape customLfoShape;
+  juce::ChangeBroadcaster customLfoShapeLoaded;
+  // published by the shared background thread, acquired by the audio thread
+  detail::RcuPointer<CustomLfoShape::Table> customLfoTables;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginProcessor)
 };
@@ -0,0 +1,28 @@
+#pragma once
+
+namespace tremolo {
+/** Displays an image fitted into the component's bounds like
+ * juce::ImageComponent but paints it with a 1:1 blit of a copy pre-scaled to
+ * the exact physical size.
+ *
+ * Until the pre-scaled copy is ready, the image is resampled on each paint.
+ */
+class PrescaledImageComponent : public juce::Component,
+                                private juce::ChangeListener {
+public:
+  explicit PrescaledImageComponent(ScaledImageCache&);
+  ~PrescaledImageComponent() override;
+
+  void setImage(const juce::Image&);
+
+  void paint(juce::Graphics&) override;
+
+private:
+  void changeListenerCallback(juce::ChangeBroadcaster*) override;
+
+  ScaledImageCache& scaledImageCache;
+  juce::Image image;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PrescaledImageComponent)
+};
+}  // namespace tremolo
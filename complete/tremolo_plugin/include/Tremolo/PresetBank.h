@@ -0,0 +1,95 @@
+#pragma once
+
+namespace tremolo {
+/** A read-only bank of presets, memory-mapped from a file.
+ *
+ * Each preset is a name and a binary state as written by BinarySerializer.
+ * Thus, applying a preset goes through setStateInformation() without any
+ * parsing or allocation. Looking a preset up by name or name hash takes
+ * constant time thanks to a hash index stored in the file.
+ *
+ * Layout; multi-byte fields are little-endian:
+ *
+ *   header, 16 bytes:
+ *     bytes 0-3    magic "TRPB"
+ *     bytes 4-5    format version
+ *     bytes 6-7    reserved; 0
+ *     bytes 8-11   record count
+ *     bytes 12-15  slot count; a power of 2
+ *   index, 4 bytes per slot:
+ *     record index + 1 or 0 if the slot is empty; slots are probed linearly
+ *     starting from the name hash modulo the slot count
+ *   records, 61 bytes each:
+ *     bytes 0-31   name in UTF-8, zero-padded
+ *     bytes 32-35  name hash; see hashName()
+ *     bytes 36-60  binary state
+ *
+ * Banks are built from preset files; see PresetBankBuilder. A bank of an
+ * older format version is invalid and has to be rebuilt.
+ *
+ * A file that doesn't match the layout results in an empty, invalid bank.
+ */
+class PresetBank {
+public:
+  static constexpr auto maxNameLength = 32uz;
+  static constexpr juce::uint16 formatVersion = 1u;
+
+  struct Preset {
+    std::string_view name;
+    juce::uint32 hash;
+    std::span<const juce::uint8, BinarySerializer::stateSize> state;
+  };
+
+  struct NamedState {
+    std::string name;
+    BinarySerializer::State state;
+  };
+
+  explicit PresetBank(const juce::File& bankFile);
+
+  [[nodiscard]] bool isValid() const noexcept;
+
+  [[nodiscard]] size_t size() const noexcept;
+
+  [[nodiscard]] Preset getPreset(size_t index) const noexcept;
+
+  [[nodiscard]] std::optional<Preset> find(
+      std::string_view name) const noexcept;
+
+  /** @return the first preset whose name has the given hash */
+  [[nodiscard]] std::optional<Preset> findByHash(
+      juce::uint32 hash) const noexcept;
+
+  /** @brief Applies the preset the same way a host restores a project */
+  static void apply(const Preset& preset, juce::AudioProcessor& processor);
+
+  /** @return the 32-bit FNV-1a hash of the name */
+  [[nodiscard]] static juce::uint32 hashName(std::string_view name) noexcept;
+
+  /** @brief Lays out a bank file's contents.
+   *
+   * The names must be unique and at most maxNameLength bytes long.
+   */
+  [[nodiscard]] static juce::MemoryBlock createBankData(
+      const std::vector<NamedState>& presets);
+
+private:
+  static constexpr auto headerSize = 16uz;
+  static constexpr auto slotSize = 4uz;
+  static constexpr auto recordSize =
+      maxNameLength + 4uz + BinarySerializer::stateSize;
+
+  template <typename Matches>
+  [[nodiscard]] std::optional<Preset> probe(juce::uint32 hash,
+                                            Matches&& matches) const noexcept;
+
+  [[nodiscard]] size_t getSlot(size_t slotIndex) const noexcept;
+
+  juce::MemoryMappedFile mappedFile;
+  const juce::uint8* data{nullptr};
+  size_t recordCount{0u};
+  size_t slotCount{0u};
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBank)
+};
+}  // namespace tremolo
@@ -0,0 +1,44 @@
+#pragma once
+
+namespace tremolo {
+/** Converts a directory of JSON plugin states into a preset bank file on a
+ * background thread.
+ *
+ * Each *.json file becomes a preset named after the file. Files that fail to
+ * parse, whose names are longer than PresetBank::maxNameLength bytes, or
+ * whose names repeat are skipped.
+ *
+ * Destroying the builder waits for the bank being built and drops all results
+ * not yet delivered. Declare it as the last member of the class whose methods
+ * the callbacks call; this way, no callback outlives that class.
+ */
+class PresetBankBuilder : private juce::AsyncUpdater {
+public:
+  using OnBuilt = std::function<void(juce::Result)>;
+
+  PresetBankBuilder();
+  ~PresetBankBuilder() override;
+
+  /** @brief Schedules buildBank() on the background thread and then
+   * onBuilt() with its result on the message thread */
+  void build(juce::File stateDirectory, juce::File bankFile, OnBuilt onBuilt);
+
+  /** @brief Builds the bank on the calling thread */
+  static juce::Result buildBank(const juce::File& stateDirectory,
+                                const juce::File& bankFile);
+
+private:
+  struct BuiltBank {
+    juce::Result result;
+    OnBuilt onBuilt;
+  };
+
+  void handleAsyncUpdate() override;
+
+  juce::CriticalSection builtBanksLock;
+  std::vector<BuiltBank> builtBanks;
+  juce::ThreadPool threadPool;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetBankBuilder)
+};
+}  // namespace tremolo
@@ -0,0 +1,43 @@
+#pragma once
+
+namespace tremolo {
+/** Keeps copies of images pre-scaled to exact physical pixel sizes.
+ *
+ * Scaling happens once per image and size on a background thread. When a
+ * scaled image becomes available, the cache sends a change message; listeners
+ * should then repaint and query the cache again.
+ *
+ * Use it on the message thread only.
+ */
+class ScaledImageCache : public juce::ChangeBroadcaster {
+public:
+  /** @return source scaled to widthPixels x heightPixels or an invalid image
+   * if the scaled copy is not ready yet; in the latter case, scaling is
+   * scheduled on the background thread */
+  [[nodiscard]] juce::Image getScaledImage(const juce::Image& source,
+                                           int widthPixels,
+                                           int heightPixels);
+
+private:
+  /** Limits memory use when editors move between displays or get resized */
+  static constexpr auto maxScaledCopiesPerImage = 4;
+
+  struct Entry {
+    juce::Image source;
+    int widthPixels;
+    int heightPixels;
+    juce::Image scaled;
+  };
+
+  static juce::Image scale(const juce::Image& source,
+                           int widthPixels,
+                           int heightPixels);
+
+  void evictOldestCopyIfFull(const juce::Image& source);
+
+  std::vector<Entry> entries;
+
+  // declared last to drop pending callbacks before other members are destroyed
+  BackgroundRenderer backgroundRenderer;
+};
+}  // namespace tremolo
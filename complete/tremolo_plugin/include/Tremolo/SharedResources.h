@@ -0,0 +1,64 @@
+#pragma once
+
+namespace tremolo {
+/** Resources shared by all plugin instances living in the same process.
+ *
+ * Access it through juce::SharedResourcePointer<SharedResources>. The object
+ * is created together with the first pointer and destroyed together with the
+ * last one. Thanks to that, a session with hundreds of tremolo instances
+ * decodes the images, loads the typefaces, and builds the look-and-feel once
+ * instead of once per editor.
+ *
+ * The images are decoded on a background thread started in the constructor.
+ * Plugin processors hold a pointer too, so the images are usually ready
+ * before the first editor opens and stay decoded while editors are closed
+ * and reopened. A change message is sent once decoding finishes.
+ *
+ * The same thread runs the background jobs of all instances, e.g., compiling
+ * custom LFO shapes, so that instances don't start threads of their own.
+ *
+ * Apart from the image getters, waitForImages(), and the thread pool, use it
+ * on the message thread only.
+ */
+class SharedResources : public juce::ChangeBroadcaster {
+public:
+  SharedResources();
+
+  /** @return the decoded image or an invalid one if decoding is in progress */
+  [[nodiscard]] juce::Image getBackgroundImage() const;
+
+  /** @return the decoded image or an invalid one if decoding is in progress */
+  [[nodiscard]] juce::Image getLogoImage() const;
+
+  /** @return true if the images got decoded within the given time */
+  bool waitForImages(int timeoutMilliseconds) const;
+
+  /** @brief Creates the look-and-feel and its typefaces on first call */
+  [[nodiscard]] CustomLookAndFeel& getLookAndFeel();
+
+  [[nodiscard]] ScaledImageCache& getScaledImageCache() noexcept;
+
+  /** @brief The single-threaded pool shared by all instances; jobs run in
+   * the order they were added.
+   *
+   * Remove an instance's jobs before destroying what they reference.
+   */
+  [[nodiscard]] juce::ThreadPool& getBackgroundThreadPool() noexcept;
+
+private:
+  void decodeImages();
+
+  juce::Image background;
+  juce::Image logo;
+  std::atomic<bool> imagesDecoded{false};
+  juce::WaitableEvent imagesDecodedEvent{true};
+
+  std::unique_ptr<CustomLookAndFeel> lookAndFeel;
+  ScaledImageCache scaledImageCache;
+
+  // declared last to finish decoding before other members are destroyed
+  juce::ThreadPool backgroundThreadPool;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SharedResources)
+};
+}  // namespace tremolo
@@ -0,0 +1,47 @@
+#pragma once
+
+namespace tremolo {
+/** Ties the LFO to the host's tempo and song position.
+ *
+ * The LFO phase is computed in closed form from the play head's position in
+ * quarter notes at the start of each block. Thus, any block renders the same
+ * no matter which blocks were rendered before it, e.g., when a region is
+ * rendered offline starting mid-song.
+ */
+class TempoSync {
+public:
+  struct Division {
+    const char* name;
+    /** the length of one LFO period */
+    double quarterNotes;
+  };
+
+  /** the choices of the tempo sync parameter follow "Off" in this order */
+  static constexpr std::array divisions{
+      Division{"1/1", 4.0},          Division{"1/2", 2.0},
+      Division{"1/2 T", 4.0 / 3.0},  Division{"1/4", 1.0},
+      Division{"1/4 T", 2.0 / 3.0},  Division{"1/8", 0.5},
+      Division{"1/8 T", 1.0 / 3.0},  Division{"1/16", 0.25},
+      Division{"1/16 T", 1.0 / 6.0}, Division{"1/32", 0.125},
+  };
+
+  /** used while the host doesn't report its tempo */
+  static constexpr auto fallbackBpm = 120.0;
+
+  struct LfoState {
+    float frequencyHz;
+    /** in [0, 1); nothing if the play head isn't moving or doesn't report
+     * its position */
+    std::optional<float> phase;
+  };
+
+  /** @return "Off" followed by the names of the divisions */
+  [[nodiscard]] static juce::StringArray getChoices();
+
+  /** @param choiceIndex index of the tempo sync parameter's choice; 0 is
+   * "Off" and must not be passed */
+  [[nodiscard]] static LfoState getLfoState(
+      int choiceIndex,
+      const juce::AudioPlayHead::PositionInfo&) noexcept;
+};
+}  // namespace tremolo
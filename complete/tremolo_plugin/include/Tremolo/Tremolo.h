@@ -5,54 +5,188 @@ enum class ApplySmoothing { no, yes };
 
 class Tremolo {
 public:
-  enum class LfoWaveform : size_t {
-    sine = 0,
-    triangle = 1,
+  using LfoWaveform = WavetableLfo::Waveform;
+
+  enum class Mode {
+    /** modulates the whole signal */
+    classic,
+    /** modulates the low and the high band in opposite phase */
+    harmonic,
   };
 
-  Tremolo() { setModulationRateHz(5.f, ApplySmoothing::no); }
+  Tremolo() {
+    setModulationRateHz(5.f, ApplySmoothing::no);
+    crossover.setCutoffFrequency(crossoverFrequencyHz);
+  }
 
-  void prepare(double sampleRate, int expectedMaxFramesPerBlock) {
-    const juce::dsp::ProcessSpec processSpec{
-        .sampleRate = sampleRate,
-        .maximumBlockSize =
-            static_cast<juce::uint32>(expectedMaxFramesPerBlock),
-        .numChannels = 1u,
-    };
-    for (auto& lfo : lfos) {
-      lfo.prepare(processSpec);
-    }
+  void prepare(double sampleRate,
+               int expectedMaxFramesPerBlock,
+               int channelCount = 2) {
+    lfo.prepare(sampleRate);
     lfoSampleFifo.prepare(sampleRate);
-    lfoTransitionSmoother.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    lfoJumpTransition.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    harmonicAmount.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    dynamicDepthAmount.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    depth.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    mix.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    crossover.prepare(sampleRate, channelCount);
+    envelopeFollower.prepare(sampleRate, channelCount);
 
     // allocate defensively
     lfoSamples.resize(4u * static_cast<size_t>(expectedMaxFramesPerBlock));
+    depthSamples.resize(lfoSamples.size());
+    levelSamples.resize(lfoSamples.size());
+    harmonicGains.resize(lfoSamples.size());
   }
 
   void setModulationRateHz(
       float rateHz,
       ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
-    const auto force = applySmoothing == ApplySmoothing::no;
-    for (auto& lfo : lfos) {
-      lfo.setFrequency(rateHz, force);
+    lfo.setFrequency(rateHz, applySmoothing == ApplySmoothing::no);
+  }
+
+  /** @param newDepth in [0, 1]; the LFO swings the gain by this much around
+   * 1 */
+  void setModulationDepth(
+      float newDepth,
+      ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    jassert(0.f <= newDepth && newDepth <= 1.f);
+    setRampTarget(depth, newDepth, applySmoothing);
+  }
+
+  /** @brief Sets the share of the processed signal in the output.
+   *
+   * The processed signal is the input times a gain modulated around 1, so
+   * mixing it with the input is the same as scaling the modulation down.
+   * Thus, the mix is folded into the modulation depth. In the harmonic mode,
+   * this also spares mixing the all-pass filtered bands with the input,
+   * which would comb-filter the output.
+   *
+   * @param newMix in [0, 1]
+   */
+  void setMix(float newMix,
+              ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    jassert(0.f <= newMix && newMix <= 1.f);
+    setRampTarget(mix, newMix, applySmoothing);
+  }
+
+  /** @brief Switches to the waveform.
+   *
+   * Unless smoothing is skipped, the jump of the LFO is glided over like a
+   * change of the custom shape. Sliding the waveform position instead would
+   * sweep through the waveforms in between, e.g., through the triangle and
+   * the square's edges from the sine to the saw.
+   */
+  void setLfoWaveform(
+      LfoWaveform waveform,
+      ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    jassert(waveform <= LfoWaveform::custom);
+
+    if (applySmoothing == ApplySmoothing::no) {
+      lfoWaveform = waveform;
+      // land exactly on the waveform, without the rest of any glide
+      lfoJumpTransition.setCurrentAndTargetValue(0.f);
+      updateLfoWaveformPosition(ApplySmoothing::no);
+      return;
     }
+
+    if (waveform == lfoWaveform) {
+      return;
+    }
+
+    glideOverLfoJump([&] {
+      lfoWaveform = waveform;
+      updateLfoWaveformPosition(ApplySmoothing::no);
+    });
   }
 
-  void setLfoWaveform(LfoWaveform waveform,
-                      ApplySmoothing applySmoothing = ApplySmoothing::yes) {
-    jassert(waveform == LfoWaveform::sine || waveform == LfoWaveform::triangle);
+  /** @param morph in [0, 1]; blends the waveform with the next one in the
+   * order of LfoWaveform; unless smoothing is skipped, the blend glides to
+   * the new amount */
+  void setLfoWaveformMorph(
+      float morph,
+      ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    jassert(0.f <= morph && morph <= 1.f);
 
-    lfoToSet = waveform;
+    lfoWaveformMorph = morph;
+    updateLfoWaveformPosition(applySmoothing);
+  }
 
+  /** @brief Switches between the modes with a short crossfade unless
+   * smoothing is skipped */
+  void setMode(Mode mode,
+               ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    if (!isHarmonicModeActive()) {
+      // the filters may hold the state from the last time the mode was on
+      crossover.reset();
+    }
+
+    const auto amount = mode == Mode::harmonic ? 1.f : 0.f;
+    if (applySmoothing == ApplySmoothing::no) {
+      harmonicAmount.setCurrentAndTargetValue(amount);
+    } else {
+      harmonicAmount.setTargetValue(amount);
+    }
+  }
+
+  /** @brief Makes the modulation depth follow the input level, with a short
+   * crossfade unless smoothing is skipped */
+  void setDynamicDepth(
+      bool enabled,
+      ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    if (!isDynamicDepthActive()) {
+      // the envelope may hold the level from the last time it was on
+      envelopeFollower.reset();
+    }
+
+    const auto amount = enabled ? 1.f : 0.f;
     if (applySmoothing == ApplySmoothing::no) {
-      currentLfo = waveform;
+      dynamicDepthAmount.setCurrentAndTargetValue(amount);
+    } else {
+      dynamicDepthAmount.setTargetValue(amount);
     }
   }
 
+  /** @param table the compiled custom LFO shape; see
+   * WavetableLfo::setCustomTable() */
+  void setCustomLfoTable(const float* table) noexcept {
+    if (lfo.getCustomTable() == table) {
+      return;
+    }
+
+    glideOverLfoJump([&] { lfo.setCustomTable(table); });
+  }
+
+  /** @brief Moves the LFO to the phase, e.g., one computed from the host's
+   * song position.
+   *
+   * Unless smoothing is skipped, a jump of the LFO, e.g., when the host
+   * loops, is glided over; the phase itself is set exactly either way.
+   *
+   * @param phase in [0, 1)
+   */
+  void setLfoPhase(
+      float phase,
+      ApplySmoothing applySmoothing = ApplySmoothing::yes) noexcept {
+    // rounding makes the running phase drift from the computed one a little;
+    // correcting that needs no glide
+    constexpr auto driftTolerance = 1e-3f;
+    const auto distance = std::abs(phase - lfo.getPhase());
+    const auto drifted = std::min(distance, 1.f - distance) < driftTolerance;
+
+    if (applySmoothing == ApplySmoothing::no || drifted) {
+      lfo.setPhase(phase);
+      return;
+    }
+
+    glideOverLfoJump([&] { lfo.setPhase(phase); });
+  }
+
   void process(juce::AudioBuffer<float>& buffer) noexcept {
-    // actual updating of the LFO waveform happens in process()
-    // to keep setLfoWaveform() idempotent
-    updateLfoWaveform();
+    if (isHarmonicModeActive()) {
+      processHarmonic(buffer);
+      return;
+    }
 
     // for each frame
     for (const auto frameIndex : std::views::iota(0, buffer.getNumSamples())) {
@@ -60,8 +194,12 @@ public:
       const auto lfoValue = getNextLfoValue();
       lfoSampleFifo.push(lfoValue);
 
+      // get the depth of this frame
+      auto frameDepth = 0.f;
+      fillWithDepthValues(buffer, frameIndex, {&frameDepth, 1uz});
+
       // calculate the modulation value
-      const auto modulationValue = modulationDepth * lfoValue + 1.f;
+      const auto modulationValue = frameDepth * lfoValue + 1.f;
 
       for (const auto channelIndex :
            std::views::iota(0, buffer.getNumChannels())) {
@@ -78,9 +216,10 @@ public:
   }
 
   void processChannelwise(juce::AudioBuffer<float>& buffer) noexcept {
-    // actual updating of the LFO waveform happens in process()
-    // to keep setLfoWaveform() idempotent
-    updateLfoWaveform();
+    if (isHarmonicModeActive()) {
+      processHarmonic(buffer);
+      return;
+    }
 
     const auto samplesToProcess = std::min(
         lfoSamples.size(), static_cast<size_t>(buffer.getNumSamples()));
@@ -90,30 +229,32 @@ public:
     jassert(samplesToProcess <= lfoSamples.size());
 
     // generate LFO signal
-    for (const auto i : std::views::iota(0u, samplesToProcess)) {
-      lfoSamples[i] = getNextLfoValue();
-      lfoSampleFifo.push(lfoSamples[i]);
+    const auto lfoBlock = std::span{lfoSamples}.first(samplesToProcess);
+    fillWithLfoValues(lfoBlock);
+    for (const auto lfoValue : lfoBlock) {
+      lfoSampleFifo.push(lfoValue);
     }
 
-    // calculate the modulation value
-    juce::FloatVectorOperations::multiply(lfoSamples.data(), modulationDepth,
-                                          samplesToProcess);
+    // calculate the modulation value; the depth goes through the same pass
+    // whether it's static, automated, or follows the input level
+    const auto depthBlock = std::span{depthSamples}.first(samplesToProcess);
+    fillWithDepthValues(buffer, 0, depthBlock);
+    juce::FloatVectorOperations::multiply(
+        lfoSamples.data(), depthSamples.data(), samplesToProcess);
     juce::FloatVectorOperations::add(lfoSamples.data(), 1.f, samplesToProcess);
 
-    // for each channel
-    for (const auto channelIndex :
-         std::views::iota(0, buffer.getNumChannels())) {
-      juce::FloatVectorOperations::multiply(
-          buffer.getWritePointer(channelIndex), lfoSamples.data(),
-          samplesToProcess);
-    }
+    // apply the modulation to several channels per pass
+    detail::applyGainToChannels(
+        buffer.getArrayOfWritePointers(),
+        static_cast<size_t>(buffer.getNumChannels()),
+        std::span{lfoSamples}.first(samplesToProcess));
   }
 
   void reset() noexcept {
-    for (auto& lfo : lfos) {
-      lfo.reset();
-    }
+    lfo.reset();
     lfoSampleFifo.reset();
+    crossover.reset();
+    envelopeFollower.reset();
   }
 
   void readAllLfoSamples(juce::AudioBuffer<float>& bufferToFill) {
@@ -121,55 +262,166 @@ public:
   }
 
 private:
-  static constexpr auto modulationDepth = 0.4f;
+  static constexpr auto crossoverFrequencyHz = 800.f;
+  /** the input level at and above which the dynamic depth is the full
+   * depth set; -12 dBFS */
+  static constexpr auto fullDepthLevel = 0.25f;
+
+  /** Gains of the input and the bands in one frame */
+  struct HarmonicGains {
+    float input;
+    float low;
+    float high;
+  };
+
+  [[nodiscard]] bool isHarmonicModeActive() const noexcept {
+    return harmonicAmount.isSmoothing() ||
+           harmonicAmount.getCurrentValue() > 0.f;
+  }
+
+  [[nodiscard]] bool isDynamicDepthActive() const noexcept {
+    return dynamicDepthAmount.isSmoothing() ||
+           dynamicDepthAmount.getCurrentValue() > 0.f;
+  }
+
+  static void setRampTarget(LinearRamp& ramp,
+                            float target,
+                            ApplySmoothing applySmoothing) noexcept {
+    if (applySmoothing == ApplySmoothing::no) {
+      ramp.setCurrentAndTargetValue(target);
+    } else {
+      ramp.setTargetValue(target);
+    }
+  }
+
+  /** @brief Computes the modulation depth of the frames starting at
+   * startFrame from the depth and mix ramps and, if dynamic depth is on,
+   * from the level of the unprocessed input */
+  void fillWithDepthValues(const juce::AudioBuffer<float>& input,
+                           int startFrame,
+                           std::span<float> depths) noexcept {
+    depth.fill(depths);
+    mix.multiply(depths);
+
+    if (!isDynamicDepthActive()) {
+      return;
+    }
 
-  static float triangle(float phase) {
-    // offset the phase by pi/2 to return 0 if phase equals 0
-    // and match the sine waveform
-    // (otherwise, the waveform starts at 1)
-    const auto offsetPhase = phase - juce::MathConstants<float>::halfPi;
+    jassert(depths.size() <= levelSamples.size());
+    const auto levels = std::span{levelSamples}.first(depths.size());
+    envelopeFollower.process(input.getArrayOfReadPointers(),
+                             static_cast<size_t>(input.getNumChannels()),
+                             startFrame, levels);
+
+    for (const auto i : std::views::iota(0uz, depths.size())) {
+      const auto levelGain = std::min(1.f, levels[i] / fullDepthLevel);
+      // crossfades from the depth set
+      const auto amount = dynamicDepthAmount.getNextValue();
+      depths[i] *= 1.f - amount + amount * levelGain;
+    }
+  }
 
-    // Source:
-    // https://thewolfsound.com/sine-saw-square-triangle-pulse-basic-waveforms-in-synthesis/#triangle
-    const auto ft = offsetPhase / juce::MathConstants<float>::twoPi;
-    return 4.f * std::abs(ft - std::floor(ft + 0.5f)) - 1.f;
+  void processHarmonic(juce::AudioBuffer<float>& buffer) noexcept {
+    const auto samplesToProcess = std::min(
+        lfoSamples.size(), static_cast<size_t>(buffer.getNumSamples()));
+
+    const auto lfoBlock = std::span{lfoSamples}.first(samplesToProcess);
+    fillWithLfoValues(lfoBlock);
+
+    const auto depthBlock = std::span{depthSamples}.first(samplesToProcess);
+    fillWithDepthValues(buffer, 0, depthBlock);
+
+    // the gains of all frames are computed up front because the crossover
+    // goes through the frames once per group of channels
+    for (const auto i : std::views::iota(0uz, samplesToProcess)) {
+      lfoSampleFifo.push(lfoBlock[i]);
+
+      const auto modulation = depthBlock[i] * lfoBlock[i];
+      // crossfades from the classic mode
+      const auto amount = harmonicAmount.getNextValue();
+      harmonicGains[i] = {
+          .input = (1.f - amount) * (1.f + modulation),
+          .low = amount * (1.f + modulation),
+          .high = amount * (1.f - modulation),
+      };
+    }
+
+    crossover.process(
+        buffer, static_cast<int>(samplesToProcess),
+        [this](int frameIndex, auto input, auto low, auto high) {
+          const auto& gains = harmonicGains[static_cast<size_t>(frameIndex)];
+          return input * gains.input + low * gains.low + high * gains.high;
+        });
   }
 
-  void updateLfoWaveform() {
-    if (lfoToSet != currentLfo) {
-      // update the smoother
-      lfoTransitionSmoother.setCurrentAndTargetValue(getNextLfoValue());
+  /** @brief Moves the LFO to the position of the waveform and the morph
+   * set; gliding to it unless smoothing is skipped */
+  void updateLfoWaveformPosition(ApplySmoothing applySmoothing) noexcept {
+    // the custom waveform is the last one and has no next one to blend with
+    const auto position =
+        lfoWaveform == LfoWaveform::custom
+            ? static_cast<float>(LfoWaveform::custom)
+            : static_cast<float>(lfoWaveform) + lfoWaveformMorph;
+    lfo.setWaveformPosition(position, applySmoothing == ApplySmoothing::no);
+  }
 
-      currentLfo = lfoToSet;
+  /** @brief Changes the LFO so that its value jumps, and glides over the
+   * jump by offsetting the LFO and fading the offset out */
+  template <typename Change>
+  void glideOverLfoJump(Change&& change) noexcept {
+    const auto valueBefore = lfo.getCurrentValue();
+    change();
+    lfoJumpTransition.setCurrentAndTargetValue(
+        lfoJumpTransition.getCurrentValue() + valueBefore -
+        lfo.getCurrentValue());
+    lfoJumpTransition.setTargetValue(0.f);
+  }
 
-      // initiate smoothing
-      lfoTransitionSmoother.setTargetValue(getNextLfoValue());
+  float getNextLfoValue() noexcept {
+    const auto value = lfo.getNextValue();
+    if (lfoJumpTransition.isSmoothing()) {
+      return value + lfoJumpTransition.getNextValue();
     }
+    return value;
   }
 
-  float getNextLfoValue() {
-    if (lfoTransitionSmoother.isSmoothing()) {
-      return lfoTransitionSmoother.getNextValue();
+  /** Equivalent to calling getNextLfoValue() for each sample */
+  void fillWithLfoValues(std::span<float> output) noexcept {
+    lfo.fill(output);
+
+    for (auto& value : output) {
+      if (!lfoJumpTransition.isSmoothing()) {
+        break;
+      }
+      value += lfoJumpTransition.getNextValue();
     }
-    // the argument is added to the generated sample, thus, we pass in 0
-    // to get just the generated sample
-    return lfos[juce::toUnderlyingType(currentLfo)].processSample(0.f);
   }
 
-  std::array<juce::dsp::Oscillator<float>, 2u> lfos{
-      juce::dsp::Oscillator<float>{[](auto phase) {
-        // start phase is -pi -> change it to 0 to match the mathematical sine
-        return std::sin(phase + juce::MathConstants<float>::pi);
-      }},
-      juce::dsp::Oscillator<float>{triangle}};
+  WavetableLfo lfo;
 
-  LfoWaveform currentLfo = LfoWaveform::sine;
-  LfoWaveform lfoToSet = currentLfo;
+  LfoWaveform lfoWaveform = LfoWaveform::sine;
+  float lfoWaveformMorph = 0.f;
 
+  /** offsets the LFO after its value has jumped, e.g., because the waveform,
+   * the custom shape, or the phase has changed */
   juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>
-      lfoTransitionSmoother{0.f};
+      lfoJumpTransition{0.f};
   std::vector<float> lfoSamples;
 
+  LinkwitzRileyCrossover crossover;
+  juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>
+      harmonicAmount{0.f};
+  std::vector<HarmonicGains> harmonicGains;
+
+  EnvelopeFollower envelopeFollower;
+  juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>
+      dynamicDepthAmount{0.f};
+  std::vector<float> levelSamples;
+
+  LinearRamp depth{0.4f};
+  LinearRamp mix{1.f};
+  std::vector<float> depthSamples;
+
   SampleFifo<float> lfoSampleFifo;
 };
 }  // namespace tremolo
@@ -0,0 +1,226 @@
+#pragma once
+
+namespace tremolo {
+/** An LFO reading the shared LfoWavetables with linear interpolation.
+ *
+ * Changing the frequency is smoothed like in juce::dsp::Oscillator. The mip
+ * level is chosen whenever the frequency or the waveform is set, so that no
+ * harmonic of the LFO exceeds the Nyquist frequency.
+ *
+ * The custom waveform reads the table set with setCustomTable() instead; it
+ * has a single level. Until a custom table is set, it plays the sine.
+ *
+ * The waveform position morphs continuously through the waveforms in the
+ * order of Waveform: position 0.25 is 3/4 of the sine and 1/4 of the
+ * triangle. Changes of the position glide over 25 milliseconds.
+ */
+class WavetableLfo {
+public:
+  using Waveform = LfoWavetables::Waveform;
+
+  void prepare(double newSampleRate) noexcept {
+    sampleRate = newSampleRate;
+    increment.reset(sampleRate, 0.05 /* 50 milliseconds */);
+    position.reset(sampleRate, 0.025 /* 25 milliseconds */);
+    setFrequency(frequencyHz, true);
+    reset();
+  }
+
+  void reset() noexcept { phase = 0.f; }
+
+  /** @return in [0, 1) */
+  [[nodiscard]] float getPhase() const noexcept { return phase; }
+
+  /** @param newPhase in [0, 1) */
+  void setPhase(float newPhase) noexcept {
+    jassert(0.f <= newPhase && newPhase < 1.f);
+    phase = newPhase;
+  }
+
+  void setFrequency(float newFrequencyHz, bool force = false) noexcept {
+    const auto newIncrement =
+        static_cast<float>(static_cast<double>(newFrequencyHz) / sampleRate);
+
+    if (force) {
+      increment.setCurrentAndTargetValue(newIncrement);
+    } else {
+      increment.setTargetValue(newIncrement);
+    }
+
+    // while ramping, the higher frequency decides the harmonics to keep
+    const auto highestFrequencyHz = std::max(
+        newFrequencyHz, static_cast<float>(increment.getCurrentValue() *
+                                           static_cast<float>(sampleRate)));
+    mipLevel = LfoWavetables::getMipLevel(highestFrequencyHz, sampleRate);
+    frequencyHz = newFrequencyHz;
+    updateTables();
+  }
+
+  /** @brief Switches to the waveform without gliding */
+  void setWaveform(Waveform newWaveform) noexcept {
+    setWaveformPosition(static_cast<float>(newWaveform), true);
+  }
+
+  /** @param newPosition in [0, Waveform::custom] */
+  void setWaveformPosition(float newPosition, bool force = false) noexcept {
+    jassert(0.f <= newPosition &&
+            newPosition <= static_cast<float>(Waveform::custom));
+
+    if (force) {
+      position.setCurrentAndTargetValue(newPosition);
+    } else {
+      position.setTargetValue(newPosition);
+    }
+    updateTables();
+  }
+
+  /** @param newCustomTable LfoWavetables::tableSize + 1 samples laid out like
+   * the built-in tables; must stay valid until replaced */
+  void setCustomTable(const float* newCustomTable) noexcept {
+    customTable = newCustomTable;
+    updateTables();
+  }
+
+  [[nodiscard]] const float* getCustomTable() const noexcept {
+    return customTable;
+  }
+
+  /** @return the value at the current phase without advancing it */
+  [[nodiscard]] float getCurrentValue() const noexcept {
+    if (position.isSmoothing()) {
+      return lookUpAt(position.getCurrentValue(), phase);
+    }
+    return blend(phase);
+  }
+
+  [[nodiscard]] float getNextValue() noexcept {
+    if (position.isSmoothing()) {
+      const auto value = lookUpAt(position.getNextValue(), phase);
+      advancePhase();
+      if (!position.isSmoothing()) {
+        updateTables();
+      }
+      return value;
+    }
+
+    const auto value = blend(phase);
+    advancePhase();
+    return value;
+  }
+
+  /** @brief Fills the output with the next LFO values.
+   *
+   * Gives the same values as calling getNextValue() repeatedly. The phases
+   * are accumulated first; the table lookups are then independent of each
+   * other, which lets the compiler vectorize them. A position on a waveform
+   * costs one lookup per sample; a position between two waveforms costs two
+   * and a blend.
+   */
+  void fill(std::span<float> output) noexcept {
+    for (auto& sample : output) {
+      sample = phase;
+      advancePhase();
+    }
+
+    if (position.isSmoothing()) {
+      for (auto& sample : output) {
+        sample = lookUpAt(position.getNextValue(), sample);
+      }
+      updateTables();
+      return;
+    }
+
+    if (blendAmount == 0.f) {
+      for (auto& sample : output) {
+        sample = lookUp(table, sample);
+      }
+      return;
+    }
+
+    for (auto& sample : output) {
+      sample = blend(sample);
+    }
+  }
+
+private:
+  void advancePhase() noexcept {
+    phase += increment.getNextValue();
+    if (phase >= 1.f) {
+      phase -= 1.f;
+    }
+  }
+
+  [[nodiscard]] static float lookUp(const float* tableToRead,
+                                    float phaseToLookUp) noexcept {
+    const auto tablePosition =
+        phaseToLookUp * static_cast<float>(LfoWavetables::tableSize);
+    const auto index = static_cast<size_t>(tablePosition);
+    const auto fraction = tablePosition - static_cast<float>(index);
+    return tableToRead[index] +
+           fraction * (tableToRead[index + 1uz] - tableToRead[index]);
+  }
+
+  /** @brief Looks up the cached tables of the current position */
+  [[nodiscard]] float blend(float phaseToLookUp) const noexcept {
+    const auto value = lookUp(table, phaseToLookUp);
+    return value + blendAmount * (lookUp(nextTable, phaseToLookUp) - value);
+  }
+
+  /** @brief Looks up any position; used while the position glides */
+  [[nodiscard]] float lookUpAt(float positionToLookUp,
+                               float phaseToLookUp) const noexcept {
+    const auto [waveform, amount] = split(positionToLookUp);
+    const auto value = lookUp(getTable(waveform), phaseToLookUp);
+    if (amount == 0.f) {
+      return value;
+    }
+    return value + amount * (lookUp(getTable(next(waveform)), phaseToLookUp) -
+                             value);
+  }
+
+  [[nodiscard]] static std::pair<Waveform, float> split(
+      float positionToSplit) noexcept {
+    const auto index = std::min(static_cast<size_t>(positionToSplit),
+                                static_cast<size_t>(Waveform::custom));
+    return {static_cast<Waveform>(index),
+            positionToSplit - static_cast<float>(index)};
+  }
+
+  [[nodiscard]] static Waveform next(Waveform waveform) noexcept {
+    return waveform == Waveform::custom
+               ? waveform
+               : static_cast<Waveform>(static_cast<size_t>(waveform) + 1uz);
+  }
+
+  [[nodiscard]] const float* getTable(Waveform waveform) const noexcept {
+    if (waveform == Waveform::custom) {
+      return customTable != nullptr
+                 ? customTable
+                 : wavetables->getTable(Waveform::sine, mipLevel).data();
+    }
+    return wavetables->getTable(waveform, mipLevel).data();
+  }
+
+  void updateTables() noexcept {
+    const auto [waveform, amount] = split(position.getCurrentValue());
+    table = getTable(waveform);
+    nextTable = getTable(next(waveform));
+    blendAmount = amount;
+  }
+
+  juce::SharedResourcePointer<LfoWavetables> wavetables;
+  size_t mipLevel{0uz};
+  const float* customTable{nullptr};
+  juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> position{0.f};
+  // cached for the current position while it doesn't glide
+  const float* table{getTable(Waveform::sine)};
+  const float* nextTable{getTable(Waveform::triangle)};
+  float blendAmount{0.f};
+
+  double sampleRate{44100.0};
+  float frequencyHz{0.f};
+  juce::SmoothedValue<float> increment{0.f};
+  /** in [0, 1) */
+  float phase{0.f};
+};
+}  // namespace tremolo
@@ -0,0 +1,78 @@
+#pragma once
+
+namespace tremolo::detail {
+/** the frames of a tile; the gains of a tile stay in the L1 cache while all
+ * channels of a batch are multiplied by them */
+inline constexpr auto channelBatchTileSize = 64uz;
+
+/** @brief Multiplies the samples by the gains.
+ *
+ * The pointers are restrict-qualified: the caller guarantees that the channel
+ * doesn't overlap the gains, so the compiler vectorizes the loop like
+ * juce::FloatVectorOperations::multiply() without a call per tile.
+ */
+inline void multiplyChannelTile(float* __restrict samples,
+                                const float* __restrict gains,
+                                size_t frameCount) noexcept {
+  for (size_t frame = 0uz; frame < frameCount; ++frame) {
+    samples[frame] *= gains[frame];
+  }
+}
+
+/** @brief Multiplies each frame of BatchSize channels by the frame's gain.
+ *
+ * The frames are processed a tile at a time, and each tile of gains is
+ * applied to all channels of the batch before the next tile is loaded. The
+ * batch size is known at compile time, so the loop over the channels is
+ * unrolled.
+ */
+template <size_t BatchSize>
+void applyGainToChannelBatch(float* const* channels,
+                             std::span<const float> gains) noexcept {
+  std::array<float*, BatchSize> batch;
+  std::copy_n(channels, BatchSize, batch.begin());
+
+  for (size_t tileStart = 0uz; tileStart < gains.size();
+       tileStart += channelBatchTileSize) {
+    const auto tileSize =
+        std::min(channelBatchTileSize, gains.size() - tileStart);
+    for (auto* const channel : batch) {
+      multiplyChannelTile(channel + tileStart, gains.data() + tileStart,
+                          tileSize);
+    }
+  }
+}
+
+/** @brief Multiplies each frame of all channels by the frame's gain.
+ *
+ * The channels are processed in batches of 8, 4, 2, and 1 channels, largest
+ * first. Thus, a 7.1.4 layout takes two passes over the gains, 8 + 4
+ * channels, instead of twelve. ChannelBatchTest measures it against a
+ * juce::FloatVectorOperations::multiply() call per channel.
+ *
+ * The channels must not overlap the gains.
+ */
+inline void applyGainToChannels(float* const* channels,
+                                size_t channelCount,
+                                std::span<const float> gains) noexcept {
+  for (; channelCount >= 8uz; channelCount -= 8uz, channels += 8) {
+    applyGainToChannelBatch<8uz>(channels, gains);
+  }
+
+  if (channelCount >= 4uz) {
+    applyGainToChannelBatch<4uz>(channels, gains);
+    channelCount -= 4uz;
+    channels += 4;
+  }
+
+  if (channelCount >= 2uz) {
+    applyGainToChannelBatch<2uz>(channels, gains);
+    channelCount -= 2uz;
+    channels += 2;
+  }
+
+  if (channelCount == 1uz) {
+    applyGainToChannelBatch<1uz>(channels, gains);
+  }
+}
+}  // namespace tremolo::detail
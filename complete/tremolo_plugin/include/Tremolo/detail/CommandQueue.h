@@ -0,0 +1,47 @@
+#pragma once
+
+namespace tremolo::detail {
+/** A single-producer, single-consumer queue of commands for the audio thread.
+ *
+ * Neither pushing nor popping locks or allocates. Commands must be trivially
+ * copyable; thus, the audio thread never frees memory when it is done with
+ * one.
+ */
+template <typename Command, size_t Capacity>
+class CommandQueue {
+  static_assert(std::is_trivially_copyable_v<Command>,
+                "commands must not own memory the audio thread would free");
+
+public:
+  /** @return false if the queue is full and the command got dropped */
+  bool push(const Command& command) noexcept {
+    const auto scope = fifo.write(1);
+
+    if (scope.blockSize1 > 0) {
+      commands[static_cast<size_t>(scope.startIndex1)] = command;
+      return true;
+    }
+
+    if (scope.blockSize2 > 0) {
+      commands[static_cast<size_t>(scope.startIndex2)] = command;
+      return true;
+    }
+
+    return false;
+  }
+
+  /** @brief Calls apply(const Command&) on each queued command in the order
+   * they were pushed and removes them from the queue */
+  template <typename Apply>
+  void popAll(Apply&& apply) noexcept {
+    const auto scope = fifo.read(fifo.getNumReady());
+    scope.forEach(
+        [&](int index) { apply(commands[static_cast<size_t>(index)]); });
+  }
+
+private:
+  // AbstractFifo keeps one slot empty
+  juce::AbstractFifo fifo{static_cast<int>(Capacity) + 1};
+  std::array<Command, Capacity + 1u> commands{};
+};
+}  // namespace tremolo::detail
@@ -0,0 +1,61 @@
+#pragma once
+
+namespace tremolo::detail {
+/** Passes the latest of a series of values from one writer thread to the
+ * audio thread.
+ *
+ * A triple buffer: the writer fills its own slot and swaps it with the shared
+ * middle slot, and the reader swaps the middle slot with its own slot if it
+ * holds a new value. Neither side locks, allocates, or waits. A value not
+ * read yet is replaced by the next one written; thus, unlike a queue, it
+ * never fills up and never drops the latest value.
+ */
+template <typename T>
+class LatestValue {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "values must not own memory the audio thread would free");
+
+public:
+  /** @brief Publishes the value, replacing one not read yet; writer thread
+   * only */
+  void write(const T& value) noexcept {
+    slots[writerIndex] = value;
+    const auto previousMiddle =
+        middle.exchange(static_cast<juce::uint8>(writerIndex | freshFlag),
+                        std::memory_order_acq_rel);
+    writerIndex = static_cast<juce::uint8>(previousMiddle & indexMask);
+  }
+
+  /** @brief Calls apply(const T&) with the latest value if one was written
+   * since the last read; audio thread only
+   *
+   * @return true if apply() was called
+   */
+  template <typename Apply>
+  bool readLatest(Apply&& apply) noexcept {
+    // only the writer sets the flag, so it can't get cleared between the
+    // check and the exchange
+    if ((middle.load(std::memory_order_relaxed) & freshFlag) == 0) {
+      return false;
+    }
+
+    const auto previousMiddle =
+        middle.exchange(readerIndex, std::memory_order_acq_rel);
+    readerIndex = static_cast<juce::uint8>(previousMiddle & indexMask);
+    apply(std::as_const(slots[readerIndex]));
+    return true;
+  }
+
+private:
+  static constexpr juce::uint8 indexMask = 0b011u;
+  static constexpr juce::uint8 freshFlag = 0b100u;
+
+  std::array<T, 3uz> slots{};
+  // the index of the middle slot and whether it holds a value not read yet
+  std::atomic<juce::uint8> middle{1u};
+  // writer thread only
+  juce::uint8 writerIndex{0u};
+  // audio thread only
+  juce::uint8 readerIndex{2u};
+};
+}  // namespace tremolo::detail
@@ -0,0 +1,115 @@
+#pragma once
+
+namespace tremolo::detail {
+/** Caches pre-rendered images of static widget layers.
+ *
+ * Each layer is rendered once per size and display scale factor and later
+ * drawn as an image blit. Images are keyed by the layer, the size, and the
+ * scale factor; thus, widgets of different sizes sharing a layer, or editors
+ * open at different scale factors, don't evict each other's images. Once the
+ * cache holds capacity images, rendering a new one evicts the least recently
+ * drawn image.
+ *
+ * Use it on the message thread only.
+ */
+template <typename LayerId>
+class LayerCache {
+public:
+  explicit LayerCache(size_t capacityValue = 16uz) : capacity{capacityValue} {
+    jassert(0uz < capacity);
+    layers.reserve(capacity);
+  }
+
+  /** @brief Draws the layer into the given bounds, rendering it first if
+   * necessary.
+   *
+   * @param renderLayer callable invoked as renderLayer(juce::Graphics&,
+   *                    juce::Rectangle<float>) with the layer's bounds
+   *                    starting at (0, 0)
+   */
+  template <typename RenderLayer>
+  void draw(juce::Graphics& g,
+            LayerId layer,
+            juce::Rectangle<float> bounds,
+            RenderLayer&& renderLayer) {
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto& image = getOrRender(
+        {.layer = layer,
+         .width = bounds.getWidth(),
+         .height = bounds.getHeight(),
+         .scale = scale},
+        std::forward<RenderLayer>(renderLayer));
+    g.drawImageTransformed(image, juce::AffineTransform::scale(1.f / scale)
+                                      .translated(bounds.getPosition()));
+  }
+
+  void clear() noexcept { layers.clear(); }
+
+  [[nodiscard]] size_t size() const noexcept { return layers.size(); }
+
+private:
+  struct Key {
+    LayerId layer;
+    float width;
+    float height;
+    float scale;
+
+    [[nodiscard]] bool operator==(const Key& other) const noexcept {
+      return layer == other.layer && juce::exactlyEqual(width, other.width) &&
+             juce::exactlyEqual(height, other.height) &&
+             juce::exactlyEqual(scale, other.scale);
+    }
+  };
+
+  struct CachedLayer {
+    Key key;
+    juce::Image image;
+    /** the value of drawCount when the image was last drawn */
+    juce::uint64 lastDrawn{0u};
+  };
+
+  template <typename RenderLayer>
+  const juce::Image& getOrRender(const Key& key, RenderLayer&& renderLayer) {
+    ++drawCount;
+
+    // the cache holds a handful of images; a linear search is the fastest
+    const auto cached = std::ranges::find(layers, key, &CachedLayer::key);
+    if (cached != layers.end()) {
+      cached->lastDrawn = drawCount;
+      return cached->image;
+    }
+
+    CachedLayer rendered{.key = key,
+                         .image = render(key, renderLayer),
+                         .lastDrawn = drawCount};
+
+    if (layers.size() < capacity) {
+      return layers.emplace_back(std::move(rendered)).image;
+    }
+
+    auto& leastRecentlyDrawn =
+        *std::ranges::min_element(layers, {}, &CachedLayer::lastDrawn);
+    leastRecentlyDrawn = std::move(rendered);
+    return leastRecentlyDrawn.image;
+  }
+
+  template <typename RenderLayer>
+  static juce::Image render(const Key& key, RenderLayer& renderLayer) {
+    juce::Image image{
+        juce::Image::ARGB,
+        juce::jmax(1, juce::roundToInt(std::ceil(key.width * key.scale))),
+        juce::jmax(1, juce::roundToInt(std::ceil(key.height * key.scale))),
+        true};
+
+    juce::Graphics g{image};
+    g.addTransform(juce::AffineTransform::scale(key.scale));
+    renderLayer(g, juce::Rectangle{0.f, 0.f, key.width, key.height});
+
+    return image;
+  }
+
+  size_t capacity;
+  std::vector<CachedLayer> layers;
+  juce::uint64 drawCount{0u};
+};
+}  // namespace tremolo::detail
@@ -0,0 +1,72 @@
+#pragma once
+
+namespace tremolo::detail {
+/** Publishes immutable objects from one writer thread to the audio thread.
+ *
+ * The writer publishes a new object with an atomic pointer swap. At its next
+ * acquire(), the audio thread takes the object over. The object it acquired
+ * before stays valid until the acquire() after that one, so the audio thread
+ * may still read it, e.g., to glide from the old object to the new one.
+ * Only then is it handed back to the writer, who deletes it at the next
+ * publish() or reclaim(). Thus, the audio thread never waits, allocates, or
+ * frees memory, and an object is never deleted while the audio thread may be
+ * reading it.
+ *
+ * Objects published faster than the audio thread acquires them are deleted by
+ * the writer right away; the audio thread only ever sees the latest one.
+ */
+template <typename T>
+class RcuPointer {
+public:
+  RcuPointer() = default;
+
+  ~RcuPointer() {
+    reclaim();
+    delete pending.exchange(nullptr);
+    delete current;
+    delete previous;
+  }
+
+  /** @brief Makes the object available to the audio thread; writer thread
+   * only */
+  void publish(std::unique_ptr<T> object) {
+    reclaim();
+    delete pending.exchange(object.release(), std::memory_order_acq_rel);
+  }
+
+  /** @brief Deletes the objects the audio thread doesn't use anymore; writer
+   * thread only */
+  void reclaim() {
+    retired.popAll([](T* object) { delete object; });
+  }
+
+  /** @return the latest published object or nullptr if none was published;
+   * audio thread only
+   *
+   * The object returned before a new one stays valid until the next
+   * acquire().
+   */
+  [[nodiscard]] const T* acquire() noexcept {
+    // only acquire() resets the pending pointer, so it can't become null
+    // between the check and the exchange
+    if (pending.load(std::memory_order_relaxed) != nullptr &&
+        (previous == nullptr || retired.push(previous))) {
+      previous = current;
+      current = pending.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    return current;
+  }
+
+private:
+  std::atomic<T*> pending{nullptr};
+  // audio thread only
+  T* current{nullptr};
+  // audio thread only; acquired before current and possibly still read
+  T* previous{nullptr};
+  // from the audio thread back to the writer
+  CommandQueue<T*, 16u> retired;
+
+  JUCE_DECLARE_NON_COPYABLE(RcuPointer)
+  JUCE_DECLARE_NON_MOVEABLE(RcuPointer)
+};
+}  // namespace tremolo::detail
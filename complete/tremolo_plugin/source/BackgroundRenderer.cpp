@@ -0,0 +1,41 @@
+namespace tremolo {
+BackgroundRenderer::BackgroundRenderer()
+    : threadPool{juce::ThreadPoolOptions{}
+                     .withThreadName("Tremolo background renderer")
+                     .withNumberOfThreads(1)} {}
+
+BackgroundRenderer::~BackgroundRenderer() {
+  [[maybe_unused]] const auto allJobsRemoved =
+      threadPool.removeAllJobs(true, 10'000);
+  jassert(allJobsRemoved);
+  cancelPendingUpdate();
+}
+
+void BackgroundRenderer::render(Render renderImage,
+                                OnRendered onImageRendered) {
+  threadPool.addJob([this, renderJob = std::move(renderImage),
+                     onRendered = std::move(onImageRendered)]() mutable {
+    auto image = renderJob();
+
+    {
+      const juce::ScopedLock lock{renderedImagesLock};
+      renderedImages.push_back({std::move(image), std::move(onRendered)});
+    }
+
+    triggerAsyncUpdate();
+  });
+}
+
+void BackgroundRenderer::handleAsyncUpdate() {
+  std::vector<RenderedImage> imagesToDeliver;
+
+  {
+    const juce::ScopedLock lock{renderedImagesLock};
+    std::swap(imagesToDeliver, renderedImages);
+  }
+
+  for (auto& [image, onRendered] : imagesToDeliver) {
+    onRendered(std::move(image));
+  }
+}
+}  // namespace tremolo
@@ -0,0 +1,187 @@
+namespace {
+constexpr std::array<juce::uint8, 4u> binaryStateMagic{'T', 'R', 'M', 'B'};
+
+namespace offsets {
+constexpr auto version = 4uz;
+constexpr auto rate = 6uz;
+constexpr auto flags = 10uz;
+constexpr auto waveform = 11uz;
+constexpr auto morph = 12uz;
+constexpr auto depth = 16uz;
+constexpr auto mix = 20uz;
+constexpr auto tempoSync = 24uz;
+}  // namespace offsets
+
+namespace stateFlags {
+constexpr juce::uint8 bypassed = 1u << 0u;
+constexpr juce::uint8 harmonic = 1u << 1u;
+constexpr juce::uint8 dynamicDepth = 1u << 2u;
+constexpr juce::uint8 known = bypassed | harmonic | dynamicDepth;
+}  // namespace stateFlags
+
+constexpr std::array<juce::uint8, 4u> customLfoShapeMagic{'T', 'R', 'C', 'S'};
+constexpr auto customLfoShapeHeaderSize = 6uz;
+constexpr auto breakpointSize = 8uz;
+
+void writeLittleEndianFloat(float value, juce::uint8* destination) noexcept {
+  const auto bits =
+      juce::ByteOrder::swapIfBigEndian(std::bit_cast<juce::uint32>(value));
+  std::memcpy(destination, &bits, sizeof(bits));
+}
+
+float readLittleEndianFloat(const juce::uint8* source) noexcept {
+  return std::bit_cast<float>(juce::ByteOrder::littleEndianInt(source));
+}
+}  // namespace
+
+namespace tremolo {
+BinarySerializer::State BinarySerializer::serialize(
+    const Parameters& parameters) noexcept {
+  State state{};
+  std::ranges::copy(binaryStateMagic, state.begin());
+
+  const auto version = juce::ByteOrder::swapIfBigEndian(formatVersion);
+  std::memcpy(state.data() + offsets::version, &version, sizeof(version));
+
+  writeLittleEndianFloat(parameters.rate.get(), state.data() + offsets::rate);
+
+  state[offsets::flags] = static_cast<juce::uint8>(
+      (parameters.bypassed.get() ? stateFlags::bypassed : 0u) |
+      (parameters.harmonic.get() ? stateFlags::harmonic : 0u) |
+      (parameters.dynamicDepth.get() ? stateFlags::dynamicDepth : 0u));
+  state[offsets::waveform] =
+      static_cast<juce::uint8>(parameters.waveform.getIndex());
+  writeLittleEndianFloat(parameters.morph.get(),
+                         state.data() + offsets::morph);
+  writeLittleEndianFloat(parameters.depth.get(),
+                         state.data() + offsets::depth);
+  writeLittleEndianFloat(parameters.mix.get(), state.data() + offsets::mix);
+  state[offsets::tempoSync] =
+      static_cast<juce::uint8>(parameters.tempoSync.getIndex());
+
+  return state;
+}
+
+bool BinarySerializer::isBinaryState(const void* data,
+                                     size_t sizeInBytes) noexcept {
+  return sizeInBytes >= binaryStateMagic.size() &&
+         std::memcmp(data, binaryStateMagic.data(), binaryStateMagic.size()) ==
+             0;
+}
+
+size_t BinarySerializer::getStateSize(const void* data,
+                                      size_t sizeInBytes) noexcept {
+  if (!isBinaryState(data, sizeInBytes) ||
+      sizeInBytes < offsets::version + sizeof(juce::uint16)) {
+    return 0uz;
+  }
+
+  const auto version = juce::ByteOrder::littleEndianShort(
+      static_cast<const juce::uint8*>(data) + offsets::version);
+  return version == formatVersion ? stateSize : 0uz;
+}
+
+juce::Result BinarySerializer::deserialize(const void* data,
+                                           size_t sizeInBytes,
+                                           Parameters& parameters) {
+  if (!isBinaryState(data, sizeInBytes)) {
+    return juce::Result::fail("not a binary state");
+  }
+
+  const auto size = getStateSize(data, sizeInBytes);
+  if (size == 0uz) {
+    return juce::Result::fail("unsupported binary state version");
+  }
+
+  if (sizeInBytes < size) {
+    return juce::Result::fail("binary state is truncated");
+  }
+
+  const auto* const bytes = static_cast<const juce::uint8*>(data);
+
+  const auto rate = readLittleEndianFloat(bytes + offsets::rate);
+  const auto flags = bytes[offsets::flags];
+  const auto waveformIndex = static_cast<int>(bytes[offsets::waveform]);
+  const auto morph = readLittleEndianFloat(bytes + offsets::morph);
+  const auto depth = readLittleEndianFloat(bytes + offsets::depth);
+  const auto mix = readLittleEndianFloat(bytes + offsets::mix);
+  const auto tempoSyncIndex = static_cast<int>(bytes[offsets::tempoSync]);
+
+  if (!std::isfinite(rate) || (flags & ~stateFlags::known) != 0 ||
+      waveformIndex >= parameters.waveform.choices.size() ||
+      !std::isfinite(morph) || !std::isfinite(depth) || !std::isfinite(mix) ||
+      tempoSyncIndex >= parameters.tempoSync.choices.size()) {
+    // don't update parameters if any of them is invalid
+    return juce::Result::fail("binary state contains invalid values");
+  }
+
+  parameters.waveform = waveformIndex;
+  parameters.rate = rate;
+  parameters.bypassed = (flags & stateFlags::bypassed) != 0;
+  parameters.harmonic = (flags & stateFlags::harmonic) != 0;
+  parameters.dynamicDepth = (flags & stateFlags::dynamicDepth) != 0;
+  parameters.morph = morph;
+  parameters.depth = depth;
+  parameters.mix = mix;
+  parameters.tempoSync = tempoSyncIndex;
+
+  return juce::Result::ok();
+}
+
+size_t BinarySerializer::getSerializedSize(
+    const CustomLfoShape& shape) noexcept {
+  return customLfoShapeHeaderSize +
+         shape.getBreakpoints().size() * breakpointSize;
+}
+
+void BinarySerializer::serialize(const CustomLfoShape& shape,
+                                 std::span<juce::uint8> destination) noexcept {
+  jassert(destination.size() >= getSerializedSize(shape));
+
+  const auto& breakpoints = shape.getBreakpoints();
+  std::ranges::copy(customLfoShapeMagic, destination.begin());
+
+  const auto count = juce::ByteOrder::swapIfBigEndian(
+      static_cast<juce::uint16>(breakpoints.size()));
+  std::memcpy(destination.data() + customLfoShapeMagic.size(), &count,
+              sizeof(count));
+
+  auto* breakpointBytes = destination.data() + customLfoShapeHeaderSize;
+  for (const auto& breakpoint : breakpoints) {
+    writeLittleEndianFloat(breakpoint.phase, breakpointBytes);
+    writeLittleEndianFloat(breakpoint.value, breakpointBytes + 4u);
+    breakpointBytes += breakpointSize;
+  }
+}
+
+std::optional<CustomLfoShape> BinarySerializer::deserializeCustomLfoShape(
+    const void* data,
+    size_t sizeInBytes) {
+  const auto* const bytes = static_cast<const juce::uint8*>(data);
+
+  if (sizeInBytes < customLfoShapeHeaderSize ||
+      std::memcmp(bytes, customLfoShapeMagic.data(),
+                  customLfoShapeMagic.size()) != 0) {
+    return std::nullopt;
+  }
+
+  const auto count = static_cast<size_t>(juce::ByteOrder::littleEndianShort(
+      bytes + customLfoShapeMagic.size()));
+  if (count > CustomLfoShape::maxBreakpointCount ||
+      sizeInBytes < customLfoShapeHeaderSize + count * breakpointSize) {
+    return std::nullopt;
+  }
+
+  std::vector<CustomLfoShape::Breakpoint> breakpoints;
+  breakpoints.reserve(count);
+  const auto* breakpointBytes = bytes + customLfoShapeHeaderSize;
+  for ([[maybe_unused]] const auto i : std::views::iota(0uz, count)) {
+    breakpoints.push_back(
+        {.phase = readLittleEndianFloat(breakpointBytes),
+         .value = readLittleEndianFloat(breakpointBytes + 4u)});
+    breakpointBytes += breakpointSize;
+  }
+
+  return CustomLfoShape{std::move(breakpoints)};
+}
+}  // namespace tremolo
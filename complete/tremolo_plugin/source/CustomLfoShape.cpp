@@ -0,0 +1,69 @@
+namespace tremolo {
+CustomLfoShape::CustomLfoShape()
+    : CustomLfoShape{
+          std::vector<Breakpoint>{{0.f, 0.f}, {0.25f, 1.f}, {0.75f, -1.f}}} {}
+
+CustomLfoShape::CustomLfoShape(std::vector<Breakpoint> breakpointsToUse)
+    : breakpoints{std::move(breakpointsToUse)} {
+  if (breakpoints.size() > maxBreakpointCount) {
+    breakpoints.resize(maxBreakpointCount);
+  }
+
+  if (breakpoints.empty()) {
+    breakpoints.push_back({});
+  }
+
+  for (auto& breakpoint : breakpoints) {
+    breakpoint.phase =
+        std::isfinite(breakpoint.phase)
+            ? juce::jlimit(0.f, std::nextafter(1.f, 0.f), breakpoint.phase)
+            : 0.f;
+    breakpoint.value = std::isfinite(breakpoint.value)
+                           ? juce::jlimit(-1.f, 1.f, breakpoint.value)
+                           : 0.f;
+  }
+
+  std::ranges::stable_sort(breakpoints, {}, &Breakpoint::phase);
+}
+
+const std::vector<CustomLfoShape::Breakpoint>& CustomLfoShape::getBreakpoints()
+    const noexcept {
+  return breakpoints;
+}
+
+float CustomLfoShape::getValueAt(float phase) const noexcept {
+  const auto next =
+      std::ranges::upper_bound(breakpoints, phase, {}, &Breakpoint::phase);
+
+  // the neighbors of the phase; the segment between the last and the first
+  // breakpoint crosses the period boundary
+  auto [previousPhase, previousValue] =
+      next == breakpoints.begin() ? breakpoints.back() : *std::prev(next);
+  auto [nextPhase, nextValue] =
+      next == breakpoints.end() ? breakpoints.front() : *next;
+
+  if (next == breakpoints.begin()) {
+    previousPhase -= 1.f;
+  }
+  if (next == breakpoints.end()) {
+    nextPhase += 1.f;
+  }
+
+  const auto segmentLength = nextPhase - previousPhase;
+  if (segmentLength <= 0.f) {
+    return nextValue;
+  }
+
+  return juce::jmap(phase, previousPhase, nextPhase, previousValue, nextValue);
+}
+
+void CustomLfoShape::compileTo(Table& table) const noexcept {
+  constexpr auto tableSize = LfoWavetables::tableSize;
+
+  for (const auto i : std::views::iota(0uz, tableSize)) {
+    table[i] =
+        getValueAt(static_cast<float>(i) / static_cast<float>(tableSize));
+  }
+  table[tableSize] = table[0];
+}
+}  // namespace tremolo
@@ -0,0 +1,149 @@
+namespace tremolo {
+CustomLfoShapeEditor::CustomLfoShapeEditor(OnShapeChanged onChanged)
+    : onShapeChanged{std::move(onChanged)} {
+  setOpaque(false);
+}
+
+void CustomLfoShapeEditor::setShape(CustomLfoShape newShape) {
+  if (newShape == shape) {
+    return;
+  }
+
+  shape = std::move(newShape);
+  draggedBreakpoint.reset();
+  repaint();
+}
+
+const CustomLfoShape& CustomLfoShapeEditor::getShape() const noexcept {
+  return shape;
+}
+
+void CustomLfoShapeEditor::setCurveColor(juce::Colour color) {
+  curveColor = color;
+  repaint();
+}
+
+void CustomLfoShapeEditor::paint(juce::Graphics& g) {
+  const auto& breakpoints = shape.getBreakpoints();
+  const auto valueAtPeriodBoundary = shape.getValueAt(0.f);
+
+  juce::Path curve;
+  curve.startNewSubPath(toPosition({0.f, valueAtPeriodBoundary}));
+  for (const auto& breakpoint : breakpoints) {
+    curve.lineTo(toPosition(breakpoint));
+  }
+  curve.lineTo(toPosition({1.f, valueAtPeriodBoundary}));
+
+  g.setColour(curveColor.withAlpha(0.6f));
+  g.strokePath(curve, juce::PathStrokeType{1.5f});
+
+  g.setColour(curveColor);
+  for (const auto& breakpoint : breakpoints) {
+    const auto position = toPosition(breakpoint);
+    const auto diameter = 2.f * breakpointRadius;
+    g.fillEllipse(juce::Rectangle{diameter, diameter}.withCentre(position));
+  }
+}
+
+void CustomLfoShapeEditor::mouseDown(const juce::MouseEvent& event) {
+  const auto position = event.position;
+
+  if (const auto index = findBreakpointAt(position)) {
+    draggedBreakpoint = shape.getBreakpoints()[*index];
+    return;
+  }
+
+  auto breakpoints = shape.getBreakpoints();
+  if (breakpoints.size() >= CustomLfoShape::maxBreakpointCount) {
+    return;
+  }
+
+  draggedBreakpoint = toBreakpoint(position);
+  breakpoints.push_back(*draggedBreakpoint);
+  changeShape(std::move(breakpoints));
+}
+
+void CustomLfoShapeEditor::mouseDrag(const juce::MouseEvent& event) {
+  if (!draggedBreakpoint.has_value()) {
+    return;
+  }
+
+  auto breakpoints = shape.getBreakpoints();
+  const auto dragged = std::ranges::find(breakpoints, *draggedBreakpoint);
+  if (dragged == breakpoints.end()) {
+    draggedBreakpoint.reset();
+    return;
+  }
+
+  *dragged = toBreakpoint(event.position);
+  draggedBreakpoint = *dragged;
+  changeShape(std::move(breakpoints));
+}
+
+void CustomLfoShapeEditor::mouseUp(const juce::MouseEvent&) {
+  draggedBreakpoint.reset();
+}
+
+void CustomLfoShapeEditor::mouseDoubleClick(const juce::MouseEvent& event) {
+  auto breakpoints = shape.getBreakpoints();
+  const auto index = findBreakpointAt(event.position);
+  if (!index.has_value() || breakpoints.size() <= 1uz) {
+    return;
+  }
+
+  breakpoints.erase(breakpoints.begin() +
+                    static_cast<std::ptrdiff_t>(*index));
+  changeShape(std::move(breakpoints));
+}
+
+juce::Point<float> CustomLfoShapeEditor::toPosition(
+    CustomLfoShape::Breakpoint breakpoint) const noexcept {
+  const auto bounds = getLocalBounds().toFloat();
+  return {
+      juce::jmap(breakpoint.phase, bounds.getX(), bounds.getRight()),
+      juce::jmap(breakpoint.value, -valueLimit, valueLimit, bounds.getBottom(),
+                 bounds.getY()),
+  };
+}
+
+CustomLfoShape::Breakpoint CustomLfoShapeEditor::toBreakpoint(
+    juce::Point<float> position) const noexcept {
+  const auto bounds = getLocalBounds().toFloat();
+  if (bounds.isEmpty()) {
+    return {};
+  }
+
+  const auto phase =
+      juce::jmap(position.x, bounds.getX(), bounds.getRight(), 0.f, 1.f);
+  const auto value = juce::jmap(position.y, bounds.getBottom(), bounds.getY(),
+                                -valueLimit, valueLimit);
+
+  // the same limits as CustomLfoShape's so that the dragged breakpoint can be
+  // found after the shape has been rebuilt
+  return {.phase = juce::jlimit(0.f, std::nextafter(1.f, 0.f), phase),
+          .value = juce::jlimit(-1.f, 1.f, value)};
+}
+
+std::optional<size_t> CustomLfoShapeEditor::findBreakpointAt(
+    juce::Point<float> position) const noexcept {
+  const auto& breakpoints = shape.getBreakpoints();
+  const auto hit = std::ranges::find_if(breakpoints, [&](const auto& b) {
+    return toPosition(b).getDistanceFrom(position) <= 2.f * breakpointRadius;
+  });
+
+  if (hit == breakpoints.end()) {
+    return std::nullopt;
+  }
+  return static_cast<size_t>(std::distance(breakpoints.begin(), hit));
+}
+
+void CustomLfoShapeEditor::changeShape(
+    std::vector<CustomLfoShape::Breakpoint> breakpoints) {
+  shape = CustomLfoShape{std::move(breakpoints)};
+  repaint();
+
+  if (onShapeChanged) {
+    onShapeChanged(shape);
+  }
+}
+}  // namespace tremolo
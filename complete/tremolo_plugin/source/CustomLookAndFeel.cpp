@@ -31,70 +31,65 @@ void drawButtonInset(juce::Graphics& g, const juce::Rectangle<float>& bounds) {
   g.setGradientFill(insetGradient);
   g.fillRoundedRectangle(bounds, 6.f);
 }
-}  // namespace
 
-juce::Colour CustomLookAndFeel::getColor(Colors colorName) {
-  static const std::array colors{
-      juce::Colour{0xFFFFAA00},
-      juce::Colour{0xFFDDECFF},
-  };
-  return colors.at(juce::toUnderlyingType(colorName));
-}
+void drawComboBoxBody(juce::Graphics& g, const juce::Rectangle<float>& bounds) {
+  drawButtonInset(g, bounds);
 
-CustomLookAndFeel::CustomLookAndFeel() {
-  setColour(juce::ComboBox::textColourId, getColor(Colors::paleBlue));
-  setColour(juce::Label::textColourId, getColor(Colors::paleBlue));
-  const juce::Colour darkBlue{0xFF153245};
-  setColour(juce::PopupMenu::backgroundColourId, darkBlue);
-  setColour(juce::PopupMenu::textColourId, getColor(Colors::paleBlue));
-  setColour(juce::PopupMenu::highlightedTextColourId, juce::Colour{0xFF0C131E});
-  setColour(juce::PopupMenu::highlightedBackgroundColourId,
-            getColor(Colors::orange));
-  setColour(juce::BubbleComponent::backgroundColourId, darkBlue);
-  setColour(juce::BubbleComponent::outlineColourId, juce::Colour{0xFF0C0E16});
+  const auto buttonBounds = bounds.reduced(buttonInsetWidth);
+  drawBlueGradientButton(g, buttonBounds);
 
-  // used to set the font of the default standalone plugin window
-  getDefaultLookAndFeel().setDefaultSansSerifTypeface(
-      interMedium().getTypeface());
-}
+  // the arrow sits in the right margin left by positionComboBoxText()
+  constexpr auto arrowWidth = 8.f;
+  const auto arrowBounds =
+      bounds.reduced(10.f, 11.f).removeFromRight(arrowWidth);
+  juce::Path arrow;
+  arrow.startNewSubPath(arrowBounds.getTopLeft());
+  arrow.lineTo(arrowBounds.getCentreX(), arrowBounds.getBottom());
+  arrow.lineTo(arrowBounds.getTopRight());
 
-juce::FontOptions CustomLookAndFeel::getSideLabelsFont() {
-  return interMedium().withPointHeight(10.f);
+  g.setColour(CustomLookAndFeel::getColor(CustomLookAndFeel::Colors::paleBlue));
+  g.fillPath(arrow);
 }
 
-juce::BorderSize<int> CustomLookAndFeel::getLabelBorderSize(juce::Label&) {
-  return juce::BorderSize{0};
+void drawToggleButtonOffBody(juce::Graphics& g,
+                             const juce::Rectangle<float>& bounds) {
+  drawButtonInset(g, bounds);
+  drawBlueGradientButton(g, bounds.reduced(buttonInsetWidth));
 }
 
-juce::FontOptions CustomLookAndFeel::getRateLabelFont() {
-  return interBold().withPointHeight(12.f);
+void drawToggleButtonOnBody(juce::Graphics& g,
+                            const juce::Rectangle<float>& bounds) {
+  drawButtonInset(g, bounds);
+  drawOrangeGradientButton(g, bounds.reduced(buttonInsetWidth));
 }
 
-void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g,
-                                         int x,
-                                         int y,
-                                         int width,
-                                         int height,
-                                         float sliderPos,
-                                         const float rotaryStartAngle,
-                                         const float rotaryEndAngle,
-                                         juce::Slider&) {
-  const auto bounds = juce::Rectangle{x, y, width, height};
-  const auto knobCanalBounds = bounds.toFloat().reduced(3.75f);
+juce::Rectangle<float> getKnobCanalBounds(
+    const juce::Rectangle<float>& bounds) {
+  return bounds.reduced(3.75f);
+}
 
+void drawKnobCanal(juce::Graphics& g, const juce::Rectangle<float>& bounds) {
   g.setColour(juce::Colour{0xFF2A3A3B});
-  g.fillEllipse(knobCanalBounds);
+  g.fillEllipse(getKnobCanalBounds(bounds));
+}
 
-  const auto valueArcBounds = knobCanalBounds.reduced(0.25f);
+void drawKnobValueArc(juce::Graphics& g,
+                      const juce::Rectangle<float>& bounds,
+                      float sliderPos,
+                      float rotaryStartAngle,
+                      float rotaryEndAngle) {
+  const auto valueArcBounds = getKnobCanalBounds(bounds).reduced(0.25f);
 
   juce::Path arc;
   const auto toAngle =
       rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
   arc.addPieSegment(valueArcBounds, rotaryStartAngle, toAngle, 0.f);
-  g.setColour(getColor(Colors::orange));
+  g.setColour(CustomLookAndFeel::getColor(CustomLookAndFeel::Colors::orange));
   g.fillPath(arc);
+}
 
-  const auto knobBounds = knobCanalBounds.reduced(4.f);
+void drawKnobBody(juce::Graphics& g, const juce::Rectangle<float>& bounds) {
+  const auto knobBounds = getKnobCanalBounds(bounds).reduced(4.f);
 
   auto knobFill = juce::ColourGradient::vertical(
       juce::Colour{0xFF4A7090}, juce::Colour{0xFF060F1C}, knobBounds);
@@ -136,6 +131,126 @@ void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g,
   g.drawEllipse(knobTopBounds, 1.f);
 }
 
+/** Renders frames of the whole knob for slider positions evenly spread
+ * between 0 and 1, stacked vertically in a single image */
+juce::Image renderKnobFilmstrip(float width,
+                                float height,
+                                float scale,
+                                float rotaryStartAngle,
+                                float rotaryEndAngle,
+                                int frameCount) {
+  const auto frameWidth =
+      juce::jmax(1, juce::roundToInt(std::ceil(width * scale)));
+  const auto frameHeight =
+      juce::jmax(1, juce::roundToInt(std::ceil(height * scale)));
+  const auto bounds = juce::Rectangle{0.f, 0.f, width, height};
+
+  juce::Image filmstrip{juce::Image::ARGB, frameWidth, frameHeight * frameCount,
+                        true, juce::SoftwareImageType{}};
+  juce::Graphics g{filmstrip};
+
+  for (const auto frame : std::views::iota(0, frameCount)) {
+    const juce::Graphics::ScopedSaveState savedState{g};
+    g.reduceClipRegion(0, frame * frameHeight, frameWidth, frameHeight);
+    g.addTransform(juce::AffineTransform::scale(scale).translated(
+        0.f, static_cast<float>(frame * frameHeight)));
+
+    const auto sliderPos =
+        static_cast<float>(frame) / static_cast<float>(frameCount - 1);
+    drawKnobCanal(g, bounds);
+    drawKnobValueArc(g, bounds, sliderPos, rotaryStartAngle, rotaryEndAngle);
+    drawKnobBody(g, bounds);
+  }
+
+  return filmstrip;
+}
+}  // namespace
+
+juce::Colour CustomLookAndFeel::getColor(Colors colorName) {
+  static const std::array colors{
+      juce::Colour{0xFFFFAA00},
+      juce::Colour{0xFFDDECFF},
+  };
+  return colors.at(juce::toUnderlyingType(colorName));
+}
+
+CustomLookAndFeel::CustomLookAndFeel()
+    : interMediumTypeface{juce::Typeface::createSystemTypefaceFor(
+          assets::InterMedium_ttf,
+          static_cast<size_t>(assets::InterMedium_ttfSize))},
+      interBoldTypeface{juce::Typeface::createSystemTypefaceFor(
+          assets::InterBold_ttf,
+          static_cast<size_t>(assets::InterBold_ttfSize))} {
+  setColour(juce::ComboBox::textColourId, getColor(Colors::paleBlue));
+  setColour(juce::Label::textColourId, getColor(Colors::paleBlue));
+  const juce::Colour darkBlue{0xFF153245};
+  setColour(juce::PopupMenu::backgroundColourId, darkBlue);
+  setColour(juce::PopupMenu::textColourId, getColor(Colors::paleBlue));
+  setColour(juce::PopupMenu::highlightedTextColourId, juce::Colour{0xFF0C131E});
+  setColour(juce::PopupMenu::highlightedBackgroundColourId,
+            getColor(Colors::orange));
+  setColour(juce::BubbleComponent::backgroundColourId, darkBlue);
+  setColour(juce::BubbleComponent::outlineColourId, juce::Colour{0xFF0C0E16});
+
+  // used to set the font of the default standalone plugin window
+  getDefaultLookAndFeel().setDefaultSansSerifTypeface(
+      interMedium().getTypeface());
+}
+
+juce::FontOptions CustomLookAndFeel::getSideLabelsFont() const {
+  return interMedium().withPointHeight(10.f);
+}
+
+juce::BorderSize<int> CustomLookAndFeel::getLabelBorderSize(juce::Label&) {
+  return juce::BorderSize{0};
+}
+
+juce::FontOptions CustomLookAndFeel::getRateLabelFont() const {
+  return interBold().withPointHeight(12.f);
+}
+
+void CustomLookAndFeel::drawRotarySlider(juce::Graphics& g,
+                                         int x,
+                                         int y,
+                                         int width,
+                                         int height,
+                                         float sliderPos,
+                                         const float rotaryStartAngle,
+                                         const float rotaryEndAngle,
+                                         juce::Slider& slider) {
+  const auto bounds = juce::Rectangle{x, y, width, height}.toFloat();
+
+  if (knobRenderingMode == KnobRenderingMode::filmstrip) {
+    const KnobFilmstripKey key{
+        .width = bounds.getWidth(),
+        .height = bounds.getHeight(),
+        .scale = g.getInternalContext().getPhysicalPixelScaleFactor(),
+        .rotaryStartAngle = rotaryStartAngle,
+        .rotaryEndAngle = rotaryEndAngle,
+    };
+
+    if (const auto& filmstrip = getKnobFilmstrip(key, slider);
+        filmstrip.image.isValid()) {
+      drawKnobFilmstripFrame(g, filmstrip, bounds, sliderPos);
+      return;
+    }
+
+    // draw layers until the filmstrip is ready
+  }
+
+  layerCache.draw(g, Layer::knobCanal, bounds, drawKnobCanal);
+  drawKnobValueArc(g, bounds, sliderPos, rotaryStartAngle, rotaryEndAngle);
+  layerCache.draw(g, Layer::knobBody, bounds, drawKnobBody);
+}
+
+void CustomLookAndFeel::setKnobRenderingMode(KnobRenderingMode mode) {
+  knobRenderingMode = mode;
+
+  if (knobRenderingMode != KnobRenderingMode::filmstrip) {
+    knobFilmstrips.clear();
+  }
+}
+
 void CustomLookAndFeel::drawComboBox(juce::Graphics& g,
                                      int width,
                                      int height,
@@ -147,20 +262,7 @@ void CustomLookAndFeel::drawComboBox(juce::Graphics& g,
                                      juce::ComboBox&) {
   const auto boxBounds = juce::Rectangle{0, 0, width, height}.toFloat();
 
-  drawButtonInset(g, boxBounds);
-
-  const auto buttonBounds = boxBounds.reduced(buttonInsetWidth);
-  drawBlueGradientButton(g, buttonBounds);
-
-  auto arrowBounds = boxBounds.reduced(10.f, 11.f);
-  arrowBounds.removeFromLeft(104);
-  juce::Path arrow;
-  arrow.startNewSubPath(arrowBounds.getTopLeft());
-  arrow.lineTo(arrowBounds.getCentreX(), arrowBounds.getBottom());
-  arrow.lineTo(arrowBounds.getTopRight());
-
-  g.setColour(getColor(Colors::paleBlue));
-  g.fillPath(arrow);
+  layerCache.draw(g, Layer::comboBox, boxBounds, drawComboBoxBody);
 }
 
 juce::Font CustomLookAndFeel::getComboBoxFont(juce::ComboBox&) {
@@ -202,15 +304,12 @@ void CustomLookAndFeel::drawToggleButton(juce::Graphics& g,
 
   const auto bounds = button.getLocalBounds().toFloat();
 
-  drawButtonInset(g, bounds);
-  const auto buttonBounds = bounds.reduced(buttonInsetWidth);
-
   if (!button.getToggleState()) {
-    drawBlueGradientButton(g, buttonBounds);
+    layerCache.draw(g, Layer::toggleButtonOff, bounds, drawToggleButtonOffBody);
     g.setColour(getColor(Colors::paleBlue));
     g.setFont(interMedium().withPointHeight(12.f));
   } else {
-    drawOrangeGradientButton(g, buttonBounds);
+    layerCache.draw(g, Layer::toggleButtonOn, bounds, drawToggleButtonOnBody);
 
     const juce::Colour textColour{0xFF501A0B};
     g.setColour(textColour);
@@ -220,15 +319,112 @@ void CustomLookAndFeel::drawToggleButton(juce::Graphics& g,
              false);
 }
 
-juce::FontOptions CustomLookAndFeel::interMedium() {
-  static const auto result = juce::Typeface::createSystemTypefaceFor(
-      assets::InterMedium_ttf, assets::InterMedium_ttfSize);
-  return juce::FontOptions{result};
+bool CustomLookAndFeel::KnobFilmstripKey::operator==(
+    const KnobFilmstripKey& other) const noexcept {
+  return juce::exactlyEqual(width, other.width) &&
+         juce::exactlyEqual(height, other.height) &&
+         juce::exactlyEqual(scale, other.scale) &&
+         juce::exactlyEqual(rotaryStartAngle, other.rotaryStartAngle) &&
+         juce::exactlyEqual(rotaryEndAngle, other.rotaryEndAngle);
+}
+
+void CustomLookAndFeel::drawKnobFilmstripFrame(
+    juce::Graphics& g,
+    const KnobFilmstrip& knobFilmstrip,
+    const juce::Rectangle<float>& bounds,
+    float sliderPos) {
+  jassert(knobFilmstrip.image.isValid());
+
+  const auto& filmstrip = knobFilmstrip.image;
+  const auto frameHeight = filmstrip.getHeight() / knobFilmstripFrameCount;
+  const auto frame = juce::jlimit(
+      0, knobFilmstripFrameCount - 1,
+      juce::roundToInt(sliderPos *
+                       static_cast<float>(knobFilmstripFrameCount - 1)));
+
+  const juce::Graphics::ScopedSaveState savedState{g};
+  g.reduceClipRegion(bounds.getSmallestIntegerContainer());
+  g.drawImageTransformed(
+      filmstrip, juce::AffineTransform::translation(
+                     0.f, -static_cast<float>(frame * frameHeight))
+                     .scaled(1.f / knobFilmstrip.key.scale)
+                     .translated(bounds.getPosition()));
+}
+
+CustomLookAndFeel::KnobFilmstrip& CustomLookAndFeel::getKnobFilmstrip(
+    const KnobFilmstripKey& key,
+    juce::Slider& slider) {
+  const auto drawsSlider = [&slider](const KnobFilmstrip& filmstrip) {
+    return std::ranges::any_of(filmstrip.sliders, [&slider](const auto& user) {
+      return user.getComponent() == &slider;
+    });
+  };
+
+  // on most paints, the slider keeps its size and scale factor
+  if (const auto filmstrip =
+          std::ranges::find(knobFilmstrips, key, &KnobFilmstrip::key);
+      filmstrip != knobFilmstrips.end() && drawsSlider(*filmstrip)) {
+    return *filmstrip;
+  }
+
+  releaseKnobFilmstrips(slider);
+
+  auto filmstrip = std::ranges::find(knobFilmstrips, key, &KnobFilmstrip::key);
+  if (filmstrip == knobFilmstrips.end()) {
+    knobFilmstrips.push_back({.key = key, .image = {}, .sliders = {}});
+    filmstrip = std::prev(knobFilmstrips.end());
+    requestKnobFilmstrip(key);
+  }
+
+  filmstrip->sliders.emplace_back(&slider);
+  return *filmstrip;
+}
+
+void CustomLookAndFeel::releaseKnobFilmstrips(const juce::Slider& slider) {
+  for (auto& filmstrip : knobFilmstrips) {
+    std::erase_if(filmstrip.sliders, [&slider](const auto& user) {
+      return user.getComponent() == nullptr || user.getComponent() == &slider;
+    });
+  }
+
+  // a filmstrip still rendering is dropped as well; its image is discarded
+  // once it arrives
+  std::erase_if(knobFilmstrips, [](const KnobFilmstrip& filmstrip) {
+    return filmstrip.sliders.empty();
+  });
+}
+
+void CustomLookAndFeel::requestKnobFilmstrip(const KnobFilmstripKey& key) {
+  backgroundRenderer.render(
+      [key] {
+        return renderKnobFilmstrip(key.width, key.height, key.scale,
+                                   key.rotaryStartAngle, key.rotaryEndAngle,
+                                   knobFilmstripFrameCount);
+      },
+      [this, key](juce::Image image) {
+        const auto filmstrip =
+            std::ranges::find(knobFilmstrips, key, &KnobFilmstrip::key);
+        if (filmstrip == knobFilmstrips.end()) {
+          // no slider draws with it anymore
+          return;
+        }
+
+        // native images blit faster in native graphics contexts
+        filmstrip->image = juce::NativeImageType{}.convert(image);
+
+        for (const auto& slider : filmstrip->sliders) {
+          if (auto* sliderToRepaint = slider.getComponent()) {
+            sliderToRepaint->repaint();
+          }
+        }
+      });
+}
+
+juce::FontOptions CustomLookAndFeel::interMedium() const {
+  return juce::FontOptions{interMediumTypeface};
 }
 
-juce::FontOptions CustomLookAndFeel::interBold() {
-  static const auto result = juce::Typeface::createSystemTypefaceFor(
-      assets::InterBold_ttf, assets::InterBold_ttfSize);
-  return juce::FontOptions{result};
+juce::FontOptions CustomLookAndFeel::interBold() const {
+  return juce::FontOptions{interBoldTypeface};
 }
 }  // namespace tremolo
@@ -34,6 +34,10 @@ SerializableParameters from(const tremolo::Parameters& p) {
       .waveform = p.waveform.getCurrentChoiceName(),
   };
 }
+
+void resetToDefault(juce::RangedAudioParameter& parameter) {
+  parameter.setValueNotifyingHost(parameter.getDefaultValue());
+}
 }  // namespace
 
 namespace tremolo {
@@ -82,6 +86,15 @@ juce::Result JsonSerializer::deserialize(juce::InputStream& input,
   parameters.rate = parsedParameters->rate;
   parameters.bypassed = parsedParameters->bypassed;
 
+  // the JSON state predates the other parameters; a project saved with it
+  // must sound as it did, whatever the instance was set to before
+  resetToDefault(parameters.harmonic);
+  resetToDefault(parameters.dynamicDepth);
+  resetToDefault(parameters.morph);
+  resetToDefault(parameters.depth);
+  resetToDefault(parameters.mix);
+  resetToDefault(parameters.tempoSync);
+
   return juce::Result::ok();
 }
 }  // namespace tremolo
@@ -3,24 +3,27 @@ namespace tremolo {
 
 LfoVisualizer::LfoVisualizer(ReadAllLfoSamples readSamples,
                              GetCurrentSampleRate getRate,
-                             IsBypassed getIsBypassed)
+                             IsBypassed getIsBypassed,
+                             CurveRenderer renderer)
     : readAllLfoSamples{std::move(readSamples)},
       getCurrentSampleRate{std::move(getRate)},
-      isBypassed{std::move(getIsBypassed)} {
-  // preallocate
-  buffer.setSize(1, static_cast<int>(getCurrentSampleRate()));
+      isBypassed{std::move(getIsBypassed)},
+      curveRenderer{renderer} {
+  reserveBufferCapacity();
 
-  samplesToPath();
+  // the curve gets built on the first vertical blank to open the editor fast
 }
 
 void LfoVisualizer::paint(juce::Graphics& g) {
-  g.fillAll(backgroundColour);
+  paintBackground(g);
 
   g.setColour(curveColor);
-  g.strokePath(lfoCurve,
-               juce::PathStrokeType{curveWidth,
-                                    juce::PathStrokeType::JointStyle::curved},
-               getLfoCurveTransform());
+
+  if (curveRenderer == CurveRenderer::scanline) {
+    plotCurveAsScanlines(g);
+  } else {
+    strokeCurve(g);
+  }
 }
 
 void LfoVisualizer::setCurveWidth(float w) {
@@ -35,14 +38,171 @@ void LfoVisualizer::setBackgroundColor(juce::Colour c) {
   backgroundColour = c;
 }
 
-void LfoVisualizer::update(double timestampSeconds) {
-  updateLfoCurve(timestampSeconds);
+void LfoVisualizer::setBackdrop(RenderBackdrop render) {
+  renderBackdrop = std::move(render);
+  setOpaque(renderBackdrop != nullptr);
+  invalidateBackdrop();
+}
+
+void LfoVisualizer::invalidateBackdrop() {
+  backdrop = {};
   repaint();
 }
 
-void LfoVisualizer::updateLfoCurve(double timestampSeconds) {
+void LfoVisualizer::setFramePacing(GetModulationRateHz getModulationRate,
+                                   float minPixelShift,
+                                   double maxFrameRate) {
+  jassert(minPixelShift > 0.f);
+  jassert(maxFrameRate > 0.0);
+
+  getModulationRateHz = std::move(getModulationRate);
+  framePacingPixelShift = minPixelShift;
+  maxFrameRateHz = maxFrameRate;
+}
+
+double LfoVisualizer::getFrameIntervalSeconds() const {
+  if (getModulationRateHz == nullptr) {
+    return 0.0;
+  }
+
+  // repaint at least once a second to show, e.g., a waveform change
+  constexpr auto maxIntervalSeconds = 1.0;
+  const auto minIntervalSeconds = 1.0 / maxFrameRateHz;
+  const auto pixelsPerSecond = getCurvePixelsPerSecond();
+
+  if (!pixelsPerSecond.has_value()) {
+    return minIntervalSeconds;
+  }
+
+  if (*pixelsPerSecond <= 0.0) {
+    return maxIntervalSeconds;
+  }
+
+  return juce::jlimit(minIntervalSeconds, maxIntervalSeconds,
+                      framePacingPixelShift / *pixelsPerSecond);
+}
+
+std::optional<double> LfoVisualizer::getCurvePixelsPerSecond() const {
+  // the plot spans the same time regardless of the LFO rate
+  constexpr auto plottedSeconds =
+      static_cast<double>(periodsToPlotOf1HzWaveform);
+  const auto bounds = getLocalBounds().toDouble();
+
+  if (isBypassed()) {
+    // the flat line scrolls in from the right
+    return bounds.getWidth() / plottedSeconds;
+  }
+
+  const auto rateHz = getModulationRateHz();
+  if (!rateHz.has_value()) {
+    return std::nullopt;
+  }
+
+  // the curve scrolls by width / plottedSeconds pixels per second and its
+  // steepest slope is 2 pi rate plottedSeconds / width LFO units per pixel
+  // (a sine's; a triangle's is smaller); thus, the width cancels out
+  const auto pixelsPerLfoUnit = bounds.getHeight() / (2.0 * curveYLimit);
+  return pixelsPerLfoUnit * juce::MathConstants<double>::twoPi *
+         static_cast<double>(*rateHz);
+}
+
+void LfoVisualizer::paintBackground(juce::Graphics& g) {
+  if (renderBackdrop == nullptr) {
+    g.fillAll(backgroundColour);
+    return;
+  }
+
+  const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+  if (!backdrop.isValid() || !juce::exactlyEqual(backdropScale, scale) ||
+      backdropBounds != getBounds()) {
+    backdrop = renderBackdrop(scale);
+    backdropScale = scale;
+    backdropBounds = getBounds();
+  }
+
+  g.drawImageTransformed(backdrop, juce::AffineTransform::scale(1.f / scale));
+}
+
+void LfoVisualizer::strokeCurve(juce::Graphics& g) {
+  if (lfoCurve.isEmpty()) {
+    return;
+  }
+
+  g.strokePath(lfoCurve,
+               juce::PathStrokeType{curveWidth,
+                                    juce::PathStrokeType::JointStyle::curved},
+               getLfoCurveTransform());
+}
+
+void LfoVisualizer::plotCurveAsScanlines(juce::Graphics& g) {
+  // nothing to plot before the first vertical blank
+  if (!lastTimestampSeconds.has_value()) {
+    return;
+  }
+
+  const auto bounds = getLocalBounds().toFloat();
+  const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+  const auto columnCount =
+      static_cast<size_t>(std::ceil(bounds.getWidth() * scale));
+
+  if (columnCount == 0u) {
+    return;
+  }
+
+  const auto columnWidth = bounds.getWidth() / static_cast<float>(columnCount);
+  const auto lastSampleIndex = lfoSamplesToPlot.size() - 1u;
+  const auto toY = [&](float sample) {
+    return juce::jmap(sample, curveYLimit, -curveYLimit, 0.f,
+                      bounds.getHeight());
+  };
+
+  // each span connects the last value of the previous column to the values
+  // of this column; fractional span ends give the antialiasing
+  auto previousY = toY(lfoSamplesToPlot.front());
+  auto sampleIndex = 0uz;
+
+  for (const auto column : std::views::iota(0uz, columnCount)) {
+    const auto columnEndIndex = (column + 1u) * lastSampleIndex / columnCount;
+    auto top = previousY;
+    auto bottom = previousY;
+
+    for (; sampleIndex <= columnEndIndex; ++sampleIndex) {
+      previousY = toY(lfoSamplesToPlot.at(sampleIndex));
+      top = juce::jmin(top, previousY);
+      bottom = juce::jmax(bottom, previousY);
+    }
+
+    g.fillRect(juce::Rectangle{static_cast<float>(column) * columnWidth,
+                               top - curveWidth / 2.f, columnWidth,
+                               bottom - top + curveWidth});
+  }
+}
+
+void LfoVisualizer::update(double timestampSeconds) {
+  // read the samples on every vertical blank so that the FIFO never overflows
   updateSamplesQueue(timestampSeconds);
-  samplesToPath();
+
+  if (!isFrameDue(timestampSeconds)) {
+    return;
+  }
+  lastFrameTimestampSeconds = timestampSeconds;
+
+  // the scanline renderer plots the samples directly
+  if (curveRenderer == CurveRenderer::pathStroke) {
+    samplesToPath();
+  }
+
+  repaint();
+}
+
+bool LfoVisualizer::isFrameDue(double timestampSeconds) const {
+  // vertical blanks jitter; don't skip one that comes slightly early
+  constexpr auto toleranceSeconds = 0.002;
+
+  return !lastFrameTimestampSeconds.has_value() ||
+         timestampSeconds - *lastFrameTimestampSeconds >=
+             getFrameIntervalSeconds() - toleranceSeconds;
 }
 
 void LfoVisualizer::updateSamplesQueue(double timestampSeconds) {
@@ -51,6 +211,7 @@ void LfoVisualizer::updateSamplesQueue(double timestampSeconds) {
     return;
   }
 
+  reserveBufferCapacity();
   readAllLfoSamples(buffer);
 
   lfoSamplesToPlot.setStride(getStride());
@@ -70,23 +231,34 @@ void LfoVisualizer::updateSamplesQueue(double timestampSeconds) {
   lastTimestampSeconds = timestampSeconds;
 }
 
+void LfoVisualizer::reserveBufferCapacity() {
+  const auto capacity = static_cast<int>(getCurrentSampleRate());
+
+  if (capacity > bufferCapacity) {
+    buffer.setSize(1, capacity, false, false, true);
+    bufferCapacity = capacity;
+  }
+}
+
 size_t LfoVisualizer::getStride() const {
   return static_cast<size_t>(getCurrentSampleRate() *
                              periodsToPlotOf1HzWaveform / pointsOnPath);
 }
 
 void LfoVisualizer::samplesToPath() {
-  juce::Path path;
-  path.startNewSubPath(0.f, lfoSamplesToPlot.front());
+  // clear() keeps the storage; each path element takes 3 floats
+  lfoCurve.clear();
+  lfoCurve.preallocateSpace(static_cast<int>(3u * pointsOnPath));
+
+  lfoCurve.startNewSubPath(0.f, lfoSamplesToPlot.front());
   for (const auto i : std::views::iota(1u, lfoSamplesToPlot.size())) {
-    path.lineTo(static_cast<float>(i), lfoSamplesToPlot.at(i));
+    lfoCurve.lineTo(static_cast<float>(i), lfoSamplesToPlot.at(i));
   }
-  lfoCurve = path;
 }
 
 // clang-format off
 juce::AffineTransform LfoVisualizer::getLfoCurveTransform() const {
-  constexpr auto ylim = 1.1f;
+  constexpr auto ylim = curveYLimit;
   const auto bounds = getLocalBounds().toFloat();
   const auto transform = juce::AffineTransform::fromTargetPoints(
       0.f, ylim,                                   /* -> */ 0.f, 0.f,
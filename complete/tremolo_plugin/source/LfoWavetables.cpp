@@ -0,0 +1,117 @@
+namespace tremolo {
+namespace {
+constexpr auto lfoTableStride = LfoWavetables::tableSize + 1uz;
+
+size_t lfoTableOffset(LfoWavetables::Waveform waveform, size_t mipLevel) {
+  return (juce::toUnderlyingType(waveform) * LfoWavetables::mipLevelCount +
+          mipLevel) *
+         lfoTableStride;
+}
+
+/** @return the amplitude of the sine at the given harmonic in the Fourier
+ * series of the waveform; the overall scale doesn't matter */
+double lfoHarmonicAmplitude(LfoWavetables::Waveform waveform, size_t harmonic) {
+  using Waveform = LfoWavetables::Waveform;
+
+  const auto n = static_cast<double>(harmonic);
+  const auto isOdd = harmonic % 2uz == 1uz;
+
+  switch (waveform) {
+    case Waveform::sine:
+      return harmonic == 1uz ? 1.0 : 0.0;
+    case Waveform::triangle:
+      if (!isOdd) {
+        return 0.0;
+      }
+      return (harmonic % 4uz == 1uz ? 1.0 : -1.0) / (n * n);
+    case Waveform::square:
+      return isOdd ? 1.0 / n : 0.0;
+    case Waveform::sawUp:
+      return (isOdd ? 1.0 : -1.0) / n;
+    case Waveform::sawDown:
+      return (isOdd ? -1.0 : 1.0) / n;
+    case Waveform::smoothedPulse: {
+      // a square with few harmonics and Lanczos sigma factors to round off
+      // the edges without ringing
+      constexpr auto harmonicCount = 15uz;
+      if (!isOdd || harmonic > harmonicCount) {
+        return 0.0;
+      }
+      const auto x = juce::MathConstants<double>::pi * n /
+                     static_cast<double>(harmonicCount + 1uz);
+      return std::sin(x) / x / n;
+    }
+    case Waveform::custom:
+      break;
+  }
+
+  jassertfalse;
+  return 0.0;
+}
+}  // namespace
+
+LfoWavetables::LfoWavetables()
+    : tables(waveformCount * mipLevelCount * lfoTableStride) {
+  std::array<double, tableSize> sine{};
+  for (const auto i : std::views::iota(0uz, tableSize)) {
+    sine[i] = std::sin(juce::MathConstants<double>::twoPi *
+                       static_cast<double>(i) / static_cast<double>(tableSize));
+  }
+
+  std::array<double, tableSize> sum{};
+
+  for (const auto waveformIndex : std::views::iota(0uz, waveformCount)) {
+    const auto waveform = static_cast<Waveform>(waveformIndex);
+    sum.fill(0.0);
+
+    for (const auto harmonic :
+         std::views::iota(1uz, maxHarmonicCount + 1uz)) {
+      if (const auto amplitude = lfoHarmonicAmplitude(waveform, harmonic);
+          amplitude != 0.0) {
+        for (const auto i : std::views::iota(0uz, tableSize)) {
+          sum[i] += amplitude * sine[(harmonic * i) % tableSize];
+        }
+      }
+
+      // the partial sum up to a power of 2 is the table of one mip level
+      if (!std::has_single_bit(harmonic)) {
+        continue;
+      }
+      const auto mipLevel = static_cast<size_t>(
+          std::countr_zero(maxHarmonicCount) - std::countr_zero(harmonic));
+
+      const auto peak = std::ranges::max(
+          sum | std::views::transform([](double x) { return std::abs(x); }));
+      auto* const table =
+          tables.data() + lfoTableOffset(waveform, mipLevel);
+      for (const auto i : std::views::iota(0uz, tableSize)) {
+        table[i] = static_cast<float>(sum[i] / peak);
+      }
+      table[tableSize] = table[0];
+    }
+  }
+}
+
+std::span<const float> LfoWavetables::getTable(Waveform waveform,
+                                               size_t mipLevel) const noexcept {
+  jassert(juce::toUnderlyingType(waveform) < waveformCount);
+  jassert(mipLevel < mipLevelCount);
+  return std::span{tables}.subspan(lfoTableOffset(waveform, mipLevel),
+                                   lfoTableStride);
+}
+
+size_t LfoWavetables::getMipLevel(float frequencyHz,
+                                  double sampleRate) noexcept {
+  if (frequencyHz <= 0.f) {
+    return 0uz;
+  }
+
+  const auto nyquistHarmonic = 0.5 * sampleRate / frequencyHz;
+  auto mipLevel = 0uz;
+  while (mipLevel + 1uz < mipLevelCount &&
+         static_cast<double>(maxHarmonicCount >> mipLevel) > nyquistHarmonic) {
+    ++mipLevel;
+  }
+  return mipLevel;
+}
+}  // namespace tremolo
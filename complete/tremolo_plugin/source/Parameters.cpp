@@ -34,12 +34,205 @@ juce::AudioParameterChoice& createWaveformParameter(
       processor,
       std::make_unique<juce::AudioParameterChoice>(
           juce::ParameterID{"modulation.waveform", versionHint},
-          "Modulation waveform", juce::StringArray{"Sine", "Triangle"}, 0));
+          "Modulation waveform",
+          juce::StringArray{"Sine", "Triangle", "Square", "Saw up", "Saw down",
+                            "Smoothed pulse", "Custom"},
+          0));
+}
+
+juce::AudioParameterBool& createHarmonicParameter(
+    juce::AudioProcessor& processor) {
+  constexpr auto versionHint = 1;
+  return addParameterToProcessor(
+      processor, std::make_unique<juce::AudioParameterBool>(
+                     juce::ParameterID{"modulation.harmonic", versionHint},
+                     "Harmonic", false));
+}
+
+juce::AudioParameterBool& createDynamicDepthParameter(
+    juce::AudioProcessor& processor) {
+  constexpr auto versionHint = 1;
+  return addParameterToProcessor(
+      processor, std::make_unique<juce::AudioParameterBool>(
+                     juce::ParameterID{"modulation.dynamicDepth", versionHint},
+                     "Dynamic depth", false));
+}
+
+juce::AudioParameterFloat& createWaveformMorphParameter(
+    juce::AudioProcessor& processor) {
+  constexpr auto versionHint = 1;
+  return addParameterToProcessor(
+      processor, std::make_unique<juce::AudioParameterFloat>(
+                     juce::ParameterID{"modulation.morph", versionHint},
+                     "Waveform morph",
+                     juce::NormalisableRange<float>{0.f, 1.f, 0.001f}, 0.f));
+}
+
+juce::AudioParameterFloat& createModulationDepthParameter(
+    juce::AudioProcessor& processor) {
+  constexpr auto versionHint = 1;
+  return addParameterToProcessor(
+      processor, std::make_unique<juce::AudioParameterFloat>(
+                     juce::ParameterID{"modulation.depth", versionHint},
+                     "Modulation depth",
+                     juce::NormalisableRange<float>{0.f, 1.f, 0.001f}, 0.4f));
+}
+
+juce::AudioParameterFloat& createMixParameter(juce::AudioProcessor& processor) {
+  constexpr auto versionHint = 1;
+  return addParameterToProcessor(
+      processor, std::make_unique<juce::AudioParameterFloat>(
+                     juce::ParameterID{"mix", versionHint}, "Mix",
+                     juce::NormalisableRange<float>{0.f, 1.f, 0.001f}, 1.f));
+}
+
+juce::AudioParameterChoice& createTempoSyncParameter(
+    juce::AudioProcessor& processor) {
+  constexpr auto versionHint = 1;
+  return addParameterToProcessor(
+      processor, std::make_unique<juce::AudioParameterChoice>(
+                     juce::ParameterID{"modulation.sync", versionHint},
+                     "Tempo sync", TempoSync::getChoices(), 0));
 }
 }  // namespace
 
 Parameters::Parameters(juce::AudioProcessor& processor)
     : rate{createModulationRateParameter(processor)},
       bypassed{createBypassedParameter(processor)},
-      waveform{createWaveformParameter(processor)} {}
+      waveform{createWaveformParameter(processor)},
+      harmonic{createHarmonicParameter(processor)},
+      dynamicDepth{createDynamicDepthParameter(processor)},
+      morph{createWaveformMorphParameter(processor)},
+      depth{createModulationDepthParameter(processor)},
+      mix{createMixParameter(processor)},
+      tempoSync{createTempoSyncParameter(processor)} {
+  publishSnapshot();
+
+  rate.addListener(this);
+  bypassed.addListener(this);
+  waveform.addListener(this);
+  harmonic.addListener(this);
+  dynamicDepth.addListener(this);
+  morph.addListener(this);
+  depth.addListener(this);
+  mix.addListener(this);
+  tempoSync.addListener(this);
+}
+
+Parameters::~Parameters() {
+  rate.removeListener(this);
+  bypassed.removeListener(this);
+  waveform.removeListener(this);
+  harmonic.removeListener(this);
+  dynamicDepth.removeListener(this);
+  morph.removeListener(this);
+  depth.removeListener(this);
+  mix.removeListener(this);
+  tempoSync.removeListener(this);
+}
+
+std::optional<ParameterSnapshot> Parameters::tryGetSnapshot() const noexcept {
+  for ([[maybe_unused]] const auto attempt :
+       std::views::iota(0, maxSnapshotReadAttempts)) {
+    const auto sequenceBefore = sequence.load(std::memory_order_acquire);
+
+    if ((sequenceBefore & 1u) != 0u) {
+      // a writer is storing nine values; this won't take long
+      continue;
+    }
+
+    const ParameterSnapshot snapshot{
+        .rate = snapshotRate.load(std::memory_order_relaxed),
+        .bypassed = snapshotBypassed.load(std::memory_order_relaxed),
+        .waveformIndex = snapshotWaveformIndex.load(std::memory_order_relaxed),
+        .morph = snapshotMorph.load(std::memory_order_relaxed),
+        .depth = snapshotDepth.load(std::memory_order_relaxed),
+        .mix = snapshotMix.load(std::memory_order_relaxed),
+        .tempoSyncIndex =
+            snapshotTempoSyncIndex.load(std::memory_order_relaxed),
+        .harmonic = snapshotHarmonic.load(std::memory_order_relaxed),
+        .dynamicDepth = snapshotDynamicDepth.load(std::memory_order_relaxed),
+        .generation = sequenceBefore,
+    };
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+      return snapshot;
+    }
+  }
+
+  return std::nullopt;
+}
+
+ParameterSnapshot Parameters::getSnapshot() const noexcept {
+  for (;;) {
+    if (const auto snapshot = tryGetSnapshot()) {
+      return *snapshot;
+    }
+    juce::Thread::yield();
+  }
+}
+
+void Parameters::parameterValueChanged(int, float) {
+  publishSnapshot();
+}
+
+void Parameters::parameterGestureChanged(int, bool) {}
+
+void Parameters::publishSnapshot() noexcept {
+  if (batchUpdateDepth.load(std::memory_order_acquire) > 0) {
+    // published once the batch ends
+    return;
+  }
+
+  storeSnapshot();
+}
+
+void Parameters::storeSnapshot() noexcept {
+  // A writer that finds another one storing leaves its change to that one
+  // instead of waiting; this way, the audio thread never spins behind the
+  // message thread. The storing writer checks the flag after it's done.
+  snapshotDirty = true;
+  while (snapshotDirty) {
+    const juce::SpinLock::ScopedTryLockType lock{publishLock};
+    if (!lock.isLocked()) {
+      return;
+    }
+    snapshotDirty = false;
+    storeSnapshotValues();
+  }
+}
+
+void Parameters::storeSnapshotValues() noexcept {
+  const auto sequenceBefore = sequence.load(std::memory_order_relaxed);
+  sequence.store(sequenceBefore + 1u, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  snapshotRate.store(rate.get(), std::memory_order_relaxed);
+  snapshotBypassed.store(bypassed.get(), std::memory_order_relaxed);
+  snapshotWaveformIndex.store(waveform.getIndex(), std::memory_order_relaxed);
+  snapshotMorph.store(morph.get(), std::memory_order_relaxed);
+  snapshotDepth.store(depth.get(), std::memory_order_relaxed);
+  snapshotMix.store(mix.get(), std::memory_order_relaxed);
+  snapshotTempoSyncIndex.store(tempoSync.getIndex(),
+                               std::memory_order_relaxed);
+  snapshotHarmonic.store(harmonic.get(), std::memory_order_relaxed);
+  snapshotDynamicDepth.store(dynamicDepth.get(), std::memory_order_relaxed);
+
+  sequence.store(sequenceBefore + 2u, std::memory_order_release);
+}
+
+Parameters::ScopedBatchUpdate::ScopedBatchUpdate(Parameters& p) noexcept
+    : parameters{p} {
+  parameters.batchUpdateDepth.fetch_add(1, std::memory_order_acq_rel);
+}
+
+Parameters::ScopedBatchUpdate::~ScopedBatchUpdate() noexcept {
+  // batches may overlap, e.g., when two threads load states at once; the last
+  // one to end publishes the changes of all of them
+  if (parameters.batchUpdateDepth.fetch_sub(1, std::memory_order_acq_rel) ==
+      1) {
+    parameters.storeSnapshot();
+  }
+}
 }  // namespace tremolo
@@ -1,23 +1,37 @@
 namespace tremolo {
+namespace {
+const juce::Colour placeholderColour{0xFF153245};
+}  // namespace
+
 PluginEditor::PluginEditor(PluginProcessor& p)
     : AudioProcessorEditor(&p),
+      pluginProcessor{p},
       waveformAttachment{p.getParameterRefs().waveform, waveformComboBox},
+      morphAttachment{p.getParameterRefs().morph, morphSlider},
+      harmonicAttachment{p.getParameterRefs().harmonic, harmonicButton},
+      dynamicDepthAttachment{p.getParameterRefs().dynamicDepth,
+                             dynamicDepthButton},
       rateAttachment{p.getParameterRefs().rate, rateSlider},
+      tempoSyncAttachment{p.getParameterRefs().tempoSync, tempoSyncComboBox},
+      depthAttachment{p.getParameterRefs().depth, depthSlider},
+      mixAttachment{p.getParameterRefs().mix, mixSlider},
       bypassAttachment{p.getParameterRefs().bypassed, bypassButton},
       lfoVisualizer{
           [&p](juce::AudioBuffer<float>& b) { p.readAllLfoSamples(b); },
           [&p] { return p.getSampleRateThreadSafe(); },
           [&p] { return p.getParameterRefs().bypassed.get(); }},
+      customLfoShapeEditor{[&p](const CustomLfoShape& shape) {
+        p.setCustomLfoShape(shape);
+      }},
       about{*this, logo,
             JucePlugin_Manufacturer "\n" JucePlugin_Name "\n" __DATE__
                                     "\n" __TIME__
                                     "\nv" JucePlugin_VersionString} {
-  background.setImage(juce::ImageCache::getFromMemory(
-      assets::Background_png, assets::Background_pngSize));
+  // images may still be decoding in the background; see updateImages()
+  sharedResources->addChangeListener(this);
+  p.getCustomLfoShapeLoadedBroadcaster().addChangeListener(this);
+  updateImages();
   addAndMakeVisible(background);
-
-  logo.setImage(
-      juce::ImageCache::getFromMemory(assets::Logo_png, assets::Logo_pngSize));
   addAndMakeVisible(logo);
 
   const auto sideFontColor = juce::Colour{0xFF6EA0C7};
@@ -30,8 +44,26 @@ PluginEditor::PluginEditor(PluginProcessor& p)
 
   waveformComboBox.addItemList(p.getParameterRefs().waveform.choices, 1);
   waveformAttachment.sendInitialUpdate();
+  waveformComboBox.onChange = [this] {
+    updateCustomLfoShapeEditorVisibility();
+  };
   addAndMakeVisible(waveformComboBox);
 
+  morphSlider.setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
+  morphSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox,
+                              true, 0, 0);
+  morphSlider.setPopupDisplayEnabled(true, true, this);
+  morphAttachment.sendInitialUpdate();
+  addAndMakeVisible(morphSlider);
+
+  harmonicAttachment.sendInitialUpdate();
+  addAndMakeVisible(harmonicButton);
+
+  dynamicDepthAttachment.sendInitialUpdate();
+  addAndMakeVisible(dynamicDepthButton);
+
+  lookAndFeel.setKnobRenderingMode(
+      CustomLookAndFeel::KnobRenderingMode::filmstrip);
   rateSlider.setSliderStyle(juce::Slider::SliderStyle::Rotary);
   rateSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox,
                              true, 0, 0);
@@ -44,6 +76,27 @@ PluginEditor::PluginEditor(PluginProcessor& p)
   rateLabel.setFont(lookAndFeel.getRateLabelFont());
   addAndMakeVisible(rateLabel);
 
+  tempoSyncComboBox.addItemList(p.getParameterRefs().tempoSync.choices, 1);
+  tempoSyncAttachment.sendInitialUpdate();
+  // the rate in Hz doesn't apply while the LFO follows the host's tempo
+  tempoSyncComboBox.onChange = [this] {
+    rateSlider.setEnabled(tempoSyncComboBox.getSelectedItemIndex() == 0);
+  };
+  tempoSyncComboBox.onChange();
+  addAndMakeVisible(tempoSyncComboBox);
+
+  for (auto* slider : {&depthSlider, &mixSlider}) {
+    slider->setSliderStyle(juce::Slider::SliderStyle::LinearHorizontal);
+    slider->setTextBoxStyle(juce::Slider::TextEntryBoxPosition::NoTextBox,
+                            true, 0, 0);
+    slider->setPopupDisplayEnabled(true, true, this);
+    addAndMakeVisible(slider);
+  }
+  depthSlider.setTextValueSuffix(" depth");
+  mixSlider.setTextValueSuffix(" mix");
+  depthAttachment.sendInitialUpdate();
+  mixAttachment.sendInitialUpdate();
+
   bypassLabel.setJustificationType(juce::Justification::left);
   bypassLabel.setMinimumHorizontalScale(1.f);
   bypassLabel.setFont(lookAndFeel.getSideLabelsFont());
@@ -62,8 +115,29 @@ PluginEditor::PluginEditor(PluginProcessor& p)
   lfoVisualizer.setCurveColor(
       lookAndFeel.getColor(CustomLookAndFeel::Colors::orange));
   lfoVisualizer.setBackgroundColor(juce::Colours::transparentBlack);
+  lfoVisualizer.setBackdrop([this](float scaleFactor) {
+    return renderLfoVisualizerBackdrop(scaleFactor);
+  });
+  lfoVisualizer.setFramePacing([&p]() -> std::optional<float> {
+    // only the sine, the triangle, and blends of the two have no edges
+    const auto& parameters = p.getParameterRefs();
+    const auto waveformPosition =
+        static_cast<float>(parameters.waveform.getIndex()) +
+        parameters.morph.get();
+    if (waveformPosition >
+        static_cast<float>(Tremolo::LfoWaveform::triangle)) {
+      return std::nullopt;
+    }
+    return p.getModulationRateHzThreadSafe();
+  });
   addAndMakeVisible(lfoVisualizer);
 
+  customLfoShapeEditor.setShape(p.getCustomLfoShape());
+  customLfoShapeEditor.setCurveColor(
+      lookAndFeel.getColor(CustomLookAndFeel::Colors::paleBlue));
+  addChildComponent(customLfoShapeEditor);
+  updateCustomLfoShapeEditorVisibility();
+
   setLookAndFeel(&lookAndFeel);
   std::cout << "Editor" << std::endl;
 
@@ -73,9 +147,16 @@ PluginEditor::PluginEditor(PluginProcessor& p)
 }
 
 PluginEditor::~PluginEditor() {
+  pluginProcessor.getCustomLfoShapeLoadedBroadcaster().removeChangeListener(
+      this);
+  sharedResources->removeChangeListener(this);
   setLookAndFeel(nullptr);
 }
 
+void PluginEditor::paint(juce::Graphics& g) {
+  g.fillAll(placeholderColour);
+}
+
 void PluginEditor::resized() {
   const auto bounds = getLocalBounds();
 
@@ -86,12 +167,21 @@ void PluginEditor::resized() {
   auto lfoVisualizerBounds = bounds.reduced(18, 27);
   lfoVisualizerBounds.removeFromTop(122);
   lfoVisualizer.setBounds(lfoVisualizerBounds);
+  customLfoShapeEditor.setBounds(lfoVisualizerBounds);
 
   auto rateSliderBounds = bounds.reduced(230, 40);
   rateSliderBounds.removeFromBottom(110);
   rateSlider.setBounds(rateSliderBounds);
   rateLabel.setBounds(rateSliderBounds);
 
+  tempoSyncComboBox.setBounds(rateSliderBounds.getRight() + 8, 66, 66, 28);
+
+  // between the rate knob and the LFO visualizer
+  auto depthAndMixBounds = juce::Rectangle{160, 126, 220, 16};
+  depthSlider.setBounds(depthAndMixBounds.removeFromLeft(106));
+  depthAndMixBounds.removeFromLeft(8);
+  mixSlider.setBounds(depthAndMixBounds);
+
   auto waveformComboBoxBounds = bounds;
   waveformComboBoxBounds.removeFromTop(66);
   waveformComboBoxBounds.removeFromRight(392);
@@ -99,6 +189,11 @@ void PluginEditor::resized() {
   waveformComboBoxBounds.removeFromLeft(16);
   waveformComboBox.setBounds(waveformComboBoxBounds);
 
+  morphSlider.setBounds(waveformComboBoxBounds.withY(
+      waveformComboBoxBounds.getBottom() + 4).withHeight(16));
+  harmonicButton.setBounds(
+      waveformComboBoxBounds.withY(morphSlider.getBottom() + 4));
+
   auto waveformLabelBounds = bounds;
   waveformLabelBounds.removeFromTop(48);
 
@@ -117,6 +212,10 @@ void PluginEditor::resized() {
   bypassButtonBounds.removeFromLeft(392);
   bypassButton.setBounds(bypassButtonBounds);
 
+  // mirrors the harmonic mode button under the waveform
+  dynamicDepthButton.setBounds(
+      bypassButtonBounds.withY(bypassButtonBounds.getBottom() + 8));
+
   auto bypassLabelBounds = bounds;
   bypassLabelBounds.removeFromTop(48);
 
@@ -128,4 +227,39 @@ void PluginEditor::resized() {
 
   bypassLabel.setBounds(bypassLabelBounds);
 }
+
+void PluginEditor::changeListenerCallback(juce::ChangeBroadcaster* source) {
+  if (source == &pluginProcessor.getCustomLfoShapeLoadedBroadcaster()) {
+    customLfoShapeEditor.setShape(pluginProcessor.getCustomLfoShape());
+    return;
+  }
+
+  updateImages();
+}
+
+void PluginEditor::updateImages() {
+  background.setImage(sharedResources->getBackgroundImage());
+  logo.setImage(sharedResources->getLogoImage());
+  lfoVisualizer.invalidateBackdrop();
+}
+
+void PluginEditor::updateCustomLfoShapeEditorVisibility() {
+  customLfoShapeEditor.setVisible(
+      waveformComboBox.getSelectedItemIndex() ==
+      static_cast<int>(juce::toUnderlyingType(Tremolo::LfoWaveform::custom)));
+}
+
+juce::Image PluginEditor::renderLfoVisualizerBackdrop(float scaleFactor) {
+  // the visualizer lies over the background only
+  const auto backgroundSnapshot = background.createComponentSnapshot(
+      lfoVisualizer.getBounds(), true, scaleFactor);
+
+  juce::Image backdrop{juce::Image::RGB, backgroundSnapshot.getWidth(),
+                       backgroundSnapshot.getHeight(), false};
+  juce::Graphics g{backdrop};
+  g.fillAll(placeholderColour);
+  g.drawImageAt(backgroundSnapshot, 0, 0);
+
+  return backdrop;
+}
 }  // namespace tremolo
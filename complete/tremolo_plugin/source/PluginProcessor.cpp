@@ -1,13 +1,75 @@
 namespace tremolo {
+namespace {
+std::unique_ptr<CustomLfoShape::Table> compileToTable(
+    const CustomLfoShape& shape) {
+  auto table = std::make_unique<CustomLfoShape::Table>();
+  shape.compileTo(*table);
+  return table;
+}
+
+/** Compiles a custom LFO shape and publishes the table to the audio thread */
+class CustomLfoShapeCompileJob : public juce::ThreadPoolJob {
+public:
+  CustomLfoShapeCompileJob(CustomLfoShape shapeToCompile,
+                           detail::RcuPointer<CustomLfoShape::Table>& tables)
+      : ThreadPoolJob{"Tremolo LFO shape compiler"},
+        shape{std::move(shapeToCompile)},
+        customLfoTables{tables} {}
+
+  JobStatus runJob() override {
+    customLfoTables.publish(compileToTable(shape));
+    return jobHasFinished;
+  }
+
+  [[nodiscard]] bool publishesTo(
+      const detail::RcuPointer<CustomLfoShape::Table>& tables) const noexcept {
+    return &customLfoTables == &tables;
+  }
+
+private:
+  CustomLfoShape shape;
+  detail::RcuPointer<CustomLfoShape::Table>& customLfoTables;
+};
+
+/** Selects the compile jobs of a single processor */
+class CustomLfoShapeCompileJobSelector : public juce::ThreadPool::JobSelector {
+public:
+  explicit CustomLfoShapeCompileJobSelector(
+      const detail::RcuPointer<CustomLfoShape::Table>& tables) noexcept
+      : customLfoTables{tables} {}
+
+  bool isJobSuitable(juce::ThreadPoolJob* job) override {
+    const auto* compileJob = dynamic_cast<CustomLfoShapeCompileJob*>(job);
+    return compileJob != nullptr && compileJob->publishesTo(customLfoTables);
+  }
+
+private:
+  const detail::RcuPointer<CustomLfoShape::Table>& customLfoTables;
+};
+}  // namespace
+
 PluginProcessor::PluginProcessor()
     : AudioProcessor(
           BusesProperties()
               .withInput("Input", juce::AudioChannelSet::stereo(), true)
               .withOutput("Output", juce::AudioChannelSet::stereo(), true)) {
+  // no compiler job runs yet, so this thread may act as the writer
+  customLfoTables.publish(compileToTable(customLfoShape));
+  currentModulationRateHz = parameters.rate.get();
+  parameterSnapshot = parameters.getSnapshot();
+
   std::cout << "Processor" << std::endl;
   DBG("Tremolo Plugin Processor constructed");
 }
 
+PluginProcessor::~PluginProcessor() {
+  // The jobs reference customLfoTables; a running one is waited for because
+  // it cannot be interrupted. Other instances' jobs are left alone.
+  CustomLfoShapeCompileJobSelector jobsOfThisInstance{customLfoTables};
+  sharedResources->getBackgroundThreadPool().removeAllJobs(
+      false, -1, &jobsOfThisInstance);
+}
+
 const juce::String PluginProcessor::getName() const {
   return TREMOLO_PLUGIN_NAME;
 }
@@ -55,14 +117,22 @@ void PluginProcessor::changeProgramName(int index,
 void PluginProcessor::prepareToPlay(double sampleRate,
                                     int expectedMaxFramesPerBlock) {
   currentSampleRate = sampleRate;
+  appliedParametersGeneration.reset();
+  wasBypassedAndNotTransitioning = false;
+  lfoPhaseSyncedSincePrepare = false;
+
+  const auto channelCount =
+      juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
 
-  tremolo.prepare(sampleRate, expectedMaxFramesPerBlock);
+  tremolo.prepare(sampleRate, expectedMaxFramesPerBlock, channelCount);
 
   bypassTransitionSmoother.prepare(
       {.sampleRate = sampleRate,
        .maximumBlockSize = static_cast<uint32_t>(expectedMaxFramesPerBlock),
-       .numChannels = static_cast<uint32_t>(juce::jmax(
-           getTotalNumInputChannels(), getTotalNumOutputChannels()))});
+       .numChannels = static_cast<uint32_t>(channelCount)});
+
+  // processBlock() isn't running now, so we can act as the consumer
+  applyPendingCommands();
 }
 
 void PluginProcessor::releaseResources() {
@@ -73,12 +143,10 @@ void PluginProcessor::releaseResources() {
 }
 
 bool PluginProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const {
-  // This is the place where you check if the layout is supported.
-  // In this template code we only support mono or stereo.
-  // Some plugin hosts, such as certain GarageBand versions, will only
-  // load plugins that support stereo bus layouts.
-  if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono() &&
-      layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo()) {
+  // Any layout up to maxChannelCount channels is supported, e.g., 5.1, 7.1.4,
+  // or 3rd-order ambisonics: the tremolo modulates all channels alike.
+  const auto& mainOutput = layouts.getMainOutputChannelSet();
+  if (mainOutput.isDisabled() || mainOutput.size() > maxChannelCount) {
     return false;
   }
 
@@ -109,23 +177,64 @@ void PluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     buffer.clear(channelToClear, 0, buffer.getNumSamples());
   }
 
+  applyPendingCommands();
+
+  if (const auto* customLfoTable = customLfoTables.acquire()) {
+    tremolo.setCustomLfoTable(customLfoTable->data());
+  }
+
+  // read once so that the parameters don't change mid-block; if a writer
+  // keeps the snapshot busy, the last block's one is still coherent
+  if (const auto newSnapshot = parameters.tryGetSnapshot()) {
+    parameterSnapshot = *newSnapshot;
+  }
+  const auto& snapshot = parameterSnapshot;
+
   const auto bypassedAndNotTransitioning =
-      parameters.bypassed.get() && !bypassTransitionSmoother.isTransitioning();
+      snapshot.bypassed && !bypassTransitionSmoother.isTransitioning();
   const auto applySmoothing =
       bypassedAndNotTransitioning ? ApplySmoothing::no : ApplySmoothing::yes;
 
-  // update the parameters
   // Skip smoothing if fully bypassed to avoid LFO waveform morphing
   // when parameters change under bypass ON.
   // For example, if the LFO waveform is the sine, and the user selects
   // the triangle under bypass ON, they will see a curved triangle slope
   // on toggling bypass OFF, which is unexpected.
-  tremolo.setModulationRateHz(parameters.rate, applySmoothing);
-  tremolo.setLfoWaveform(
-      static_cast<Tremolo::LfoWaveform>(parameters.waveform.getIndex()),
-      applySmoothing);
+  // A change that lands during the fade to bypass is applied smoothed; it is
+  // applied once more without smoothing when the fade ends.
+  const auto bypassJustSettled =
+      bypassedAndNotTransitioning && !wasBypassedAndNotTransitioning;
+  wasBypassedAndNotTransitioning = bypassedAndNotTransitioning;
+
+  // otherwise, update the parameters only if any of them changed; setting
+  // them is the largest fixed cost of small blocks
+  if (appliedParametersGeneration != snapshot.generation || bypassJustSettled) {
+    appliedParametersGeneration = snapshot.generation;
+
+    if (snapshot.tempoSyncIndex == 0) {
+      tremolo.setModulationRateHz(snapshot.rate, applySmoothing);
+    }
+    tremolo.setLfoWaveform(
+        static_cast<Tremolo::LfoWaveform>(snapshot.waveformIndex),
+        applySmoothing);
+    tremolo.setLfoWaveformMorph(snapshot.morph, applySmoothing);
+    tremolo.setModulationDepth(snapshot.depth, applySmoothing);
+    tremolo.setMix(snapshot.mix, applySmoothing);
+    tremolo.setMode(
+        snapshot.harmonic ? Tremolo::Mode::harmonic : Tremolo::Mode::classic,
+        applySmoothing);
+    tremolo.setDynamicDepth(snapshot.dynamicDepth, applySmoothing);
+
+    bypassTransitionSmoother.setBypass(snapshot.bypassed);
+  }
 
-  bypassTransitionSmoother.setBypass(parameters.bypassed);
+  // the phase is computed anew for each block, so it's right even if the
+  // previous blocks were bypassed
+  if (snapshot.tempoSyncIndex != 0) {
+    syncLfoToPlayHead(snapshot.tempoSyncIndex);
+  } else {
+    currentModulationRateHz.store(snapshot.rate, std::memory_order_relaxed);
+  }
 
   if (bypassedAndNotTransitioning) {
     // avoid processing if the plugin is fully bypassed
@@ -134,8 +243,8 @@ void PluginProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 
   bypassTransitionSmoother.setDryBuffer(buffer);
 
-  // apply tremolo
-  tremolo.process(buffer);
+  // apply tremolo; the LFO gain is applied to batches of channels
+  tremolo.processChannelwise(buffer);
 
   bypassTransitionSmoother.mixToWetBuffer(buffer);
 }
@@ -150,14 +259,49 @@ juce::AudioProcessorEditor* PluginProcessor::createEditor() {
 }
 
 void PluginProcessor::getStateInformation(juce::MemoryBlock& destData) {
-  juce::MemoryOutputStream outputStream{destData, true};
-  JsonSerializer::serialize(parameters, outputStream);
+  // Encoding the binary state costs about as much as copying a cached one,
+  // so the state is encoded on every call; hosts polling it periodically
+  // get a copy of the state without any allocation on our side as long as
+  // its size doesn't change.
+  const auto state = BinarySerializer::serialize(parameters);
+
+  const juce::ScopedLock lock{customLfoShapeLock};
+  const auto shapeSize = BinarySerializer::getSerializedSize(customLfoShape);
+  destData.setSize(state.size() + shapeSize);
+
+  const std::span bytes{static_cast<juce::uint8*>(destData.getData()),
+                        destData.getSize()};
+  std::ranges::copy(state, bytes.begin());
+  BinarySerializer::serialize(customLfoShape, bytes.subspan(state.size()));
 }
 
 void PluginProcessor::setStateInformation(const void* data, int sizeInBytes) {
-  juce::MemoryInputStream inputStream{data, static_cast<size_t>(sizeInBytes),
-                                      false};
-  const auto result = JsonSerializer::deserialize(inputStream, parameters);
+  const auto size = static_cast<size_t>(sizeInBytes);
+  auto result = juce::Result::ok();
+
+  {
+    // the audio thread sees either the old or the new state, never a mix
+    const Parameters::ScopedBatchUpdate batchUpdate{parameters};
+
+    // projects saved by earlier versions store the state as JSON
+    if (BinarySerializer::isBinaryState(data, size)) {
+      result = BinarySerializer::deserialize(data, size, parameters);
+
+      // states of presets carry no custom LFO shape
+      const auto stateSize = BinarySerializer::getStateSize(data, size);
+      if (result.wasOk() && size > stateSize) {
+        if (auto shape = BinarySerializer::deserializeCustomLfoShape(
+                static_cast<const juce::uint8*>(data) + stateSize,
+                size - stateSize)) {
+          setCustomLfoShape(std::move(*shape));
+          customLfoShapeLoaded.sendChangeMessage();
+        }
+      }
+    } else {
+      juce::MemoryInputStream inputStream{data, size, false};
+      result = JsonSerializer::deserialize(inputStream, parameters);
+    }
+  }
 
   if (result.failed()) {
     // Notify the user that reading parameters failed.
@@ -170,11 +314,61 @@ void PluginProcessor::setStateInformation(const void* data, int sizeInBytes) {
   // For example, the default LFO waveform is the sine. If the project or preset
   // has the triangle selected, the user will see a curved triangle slope
   // on load, which is unexpected.
-  bypassTransitionSmoother.setBypassForced(parameters.bypassed);
-  tremolo.setLfoWaveform(
-      static_cast<Tremolo::LfoWaveform>(parameters.waveform.getIndex()),
-      ApplySmoothing::no);
-  tremolo.setModulationRateHz(parameters.rate, ApplySmoothing::no);
+  // The DSP objects belong to the audio thread; hence, the command.
+  const auto snapshot = parameters.getSnapshot();
+  // A state loaded before the audio thread applied the previous one replaces
+  // it; thus, loading never allocates or gets dropped.
+  forcedParameters.write({.rate = snapshot.rate,
+                          .bypassed = snapshot.bypassed,
+                          .waveformIndex = snapshot.waveformIndex,
+                          .harmonic = snapshot.harmonic,
+                          .dynamicDepth = snapshot.dynamicDepth,
+                          .morph = snapshot.morph,
+                          .depth = snapshot.depth,
+                          .mix = snapshot.mix});
+}
+
+void PluginProcessor::applyPendingCommands() noexcept {
+  forcedParameters.readLatest([this](const ForceParametersCommand& command) {
+    bypassTransitionSmoother.setBypassForced(command.bypassed);
+    tremolo.setLfoWaveform(
+        static_cast<Tremolo::LfoWaveform>(command.waveformIndex),
+        ApplySmoothing::no);
+    tremolo.setLfoWaveformMorph(command.morph, ApplySmoothing::no);
+    tremolo.setModulationDepth(command.depth, ApplySmoothing::no);
+    tremolo.setMix(command.mix, ApplySmoothing::no);
+    tremolo.setModulationRateHz(command.rate, ApplySmoothing::no);
+    tremolo.setMode(
+        command.harmonic ? Tremolo::Mode::harmonic : Tremolo::Mode::classic,
+        ApplySmoothing::no);
+    tremolo.setDynamicDepth(command.dynamicDepth, ApplySmoothing::no);
+  });
+}
+
+void PluginProcessor::syncLfoToPlayHead(int tempoSyncIndex) noexcept {
+  juce::AudioPlayHead::PositionInfo position;
+  if (auto* const playHead = getPlayHead()) {
+    position = playHead->getPosition().orFallback(position);
+  }
+
+  const auto lfoState = TempoSync::getLfoState(tempoSyncIndex, position);
+  tremolo.setModulationRateHz(lfoState.frequencyHz, ApplySmoothing::no);
+  currentModulationRateHz.store(lfoState.frequencyHz,
+                                std::memory_order_relaxed);
+
+  if (!lfoState.phase.has_value()) {
+    // the LFO runs freely at the synced rate
+    return;
+  }
+
+  // Renders must not depend on what played before them, so the first phase
+  // after prepareToPlay() and every phase of an offline render are set
+  // exactly. Otherwise, jumps, e.g., when the host loops, are glided over.
+  const auto applySmoothing = lfoPhaseSyncedSincePrepare && !isNonRealtime()
+                                  ? ApplySmoothing::yes
+                                  : ApplySmoothing::no;
+  tremolo.setLfoPhase(*lfoState.phase, applySmoothing);
+  lfoPhaseSyncedSincePrepare = true;
 }
 
 Parameters& PluginProcessor::getParameterRefs() noexcept {
@@ -194,6 +388,39 @@ void PluginProcessor::readAllLfoSamples(
 double PluginProcessor::getSampleRateThreadSafe() const noexcept {
   return currentSampleRate;
 }
+
+float PluginProcessor::getModulationRateHzThreadSafe() const noexcept {
+  return currentModulationRateHz.load(std::memory_order_relaxed);
+}
+
+void PluginProcessor::setCustomLfoShape(CustomLfoShape shape) {
+  {
+    const juce::ScopedLock lock{customLfoShapeLock};
+    if (shape == customLfoShape) {
+      return;
+    }
+    customLfoShape = shape;
+  }
+
+  compileCustomLfoShape(std::move(shape));
+}
+
+CustomLfoShape PluginProcessor::getCustomLfoShape() const {
+  const juce::ScopedLock lock{customLfoShapeLock};
+  return customLfoShape;
+}
+
+juce::ChangeBroadcaster&
+PluginProcessor::getCustomLfoShapeLoadedBroadcaster() noexcept {
+  return customLfoShapeLoaded;
+}
+
+void PluginProcessor::compileCustomLfoShape(CustomLfoShape shape) {
+  // the shared pool has a single thread, which compiles the shapes in order
+  // and is thus the only writer of customLfoTables
+  sharedResources->getBackgroundThreadPool().addJob(
+      new CustomLfoShapeCompileJob{std::move(shape), customLfoTables}, true);
+}
 }  // namespace tremolo
 
 // This creates new instances of the plugin.
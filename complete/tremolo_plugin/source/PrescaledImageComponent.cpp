@@ -0,0 +1,47 @@
+namespace tremolo {
+PrescaledImageComponent::PrescaledImageComponent(ScaledImageCache& cache)
+    : scaledImageCache{cache} {
+  scaledImageCache.addChangeListener(this);
+}
+
+PrescaledImageComponent::~PrescaledImageComponent() {
+  scaledImageCache.removeChangeListener(this);
+}
+
+void PrescaledImageComponent::setImage(const juce::Image& newImage) {
+  if (image == newImage) {
+    return;
+  }
+
+  image = newImage;
+  repaint();
+}
+
+void PrescaledImageComponent::paint(juce::Graphics& g) {
+  if (!image.isValid()) {
+    return;
+  }
+
+  // the same placement as juce::ImageComponent's default one
+  const auto imageBounds =
+      juce::RectanglePlacement{juce::RectanglePlacement::centred}.appliedTo(
+          image.getBounds().toFloat(), getLocalBounds().toFloat());
+  const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+  const auto scaled = scaledImageCache.getScaledImage(
+      image, juce::roundToInt(imageBounds.getWidth() * scale),
+      juce::roundToInt(imageBounds.getHeight() * scale));
+
+  if (scaled.isValid()) {
+    g.drawImageTransformed(scaled, juce::AffineTransform::scale(1.f / scale)
+                                       .translated(imageBounds.getPosition()));
+    return;
+  }
+
+  g.drawImage(image, imageBounds);
+}
+
+void PrescaledImageComponent::changeListenerCallback(juce::ChangeBroadcaster*) {
+  repaint();
+}
+}  // namespace tremolo
@@ -0,0 +1,165 @@
+namespace {
+constexpr std::array<juce::uint8, 4u> presetBankMagic{'T', 'R', 'P', 'B'};
+
+void writeUint16LittleEndian(juce::uint16 value, juce::uint8* destination) {
+  const auto littleEndianValue = juce::ByteOrder::swapIfBigEndian(value);
+  std::memcpy(destination, &littleEndianValue, sizeof(littleEndianValue));
+}
+
+void writeUint32LittleEndian(juce::uint32 value, juce::uint8* destination) {
+  const auto littleEndianValue = juce::ByteOrder::swapIfBigEndian(value);
+  std::memcpy(destination, &littleEndianValue, sizeof(littleEndianValue));
+}
+}  // namespace
+
+namespace tremolo {
+PresetBank::PresetBank(const juce::File& bankFile)
+    : mappedFile{bankFile, juce::MemoryMappedFile::readOnly} {
+  const auto* const bytes =
+      static_cast<const juce::uint8*>(mappedFile.getData());
+  const auto fileSize = mappedFile.getSize();
+
+  if (bytes == nullptr || fileSize < headerSize ||
+      std::memcmp(bytes, presetBankMagic.data(), presetBankMagic.size()) != 0 ||
+      juce::ByteOrder::littleEndianShort(bytes + 4) != formatVersion) {
+    return;
+  }
+
+  const auto records =
+      static_cast<size_t>(juce::ByteOrder::littleEndianInt(bytes + 8));
+  const auto slots =
+      static_cast<size_t>(juce::ByteOrder::littleEndianInt(bytes + 12));
+
+  if (slots == 0u || !juce::isPowerOfTwo(slots) ||
+      fileSize != headerSize + slots * slotSize + records * recordSize) {
+    return;
+  }
+
+  // validate the index once so that lookups can trust it
+  for (const auto slotIndex : std::views::iota(0uz, slots)) {
+    if (juce::ByteOrder::littleEndianInt(bytes + headerSize +
+                                         slotIndex * slotSize) > records) {
+      return;
+    }
+  }
+
+  data = bytes;
+  recordCount = records;
+  slotCount = slots;
+}
+
+bool PresetBank::isValid() const noexcept {
+  return data != nullptr;
+}
+
+size_t PresetBank::size() const noexcept {
+  return recordCount;
+}
+
+PresetBank::Preset PresetBank::getPreset(size_t index) const noexcept {
+  jassert(index < recordCount);
+
+  const auto* const record =
+      data + headerSize + slotCount * slotSize + index * recordSize;
+  const auto* const name = reinterpret_cast<const char*>(record);
+  const auto nameLength = static_cast<size_t>(
+      std::find(name, name + maxNameLength, '\0') - name);
+
+  return {
+      .name = std::string_view{name, nameLength},
+      .hash = juce::ByteOrder::littleEndianInt(record + maxNameLength),
+      .state = std::span<const juce::uint8, BinarySerializer::stateSize>{
+          record + maxNameLength + 4u, BinarySerializer::stateSize},
+  };
+}
+
+std::optional<PresetBank::Preset> PresetBank::find(
+    std::string_view name) const noexcept {
+  return probe(hashName(name),
+               [name](const Preset& preset) { return preset.name == name; });
+}
+
+std::optional<PresetBank::Preset> PresetBank::findByHash(
+    juce::uint32 hash) const noexcept {
+  return probe(hash, [](const Preset&) { return true; });
+}
+
+template <typename Matches>
+std::optional<PresetBank::Preset> PresetBank::probe(
+    juce::uint32 hash,
+    Matches&& matches) const noexcept {
+  // the table is at most half full, so probing ends at an empty slot soon
+  for (const auto step : std::views::iota(0uz, slotCount)) {
+    const auto slot = getSlot((hash + step) & (slotCount - 1u));
+
+    if (slot == 0u) {
+      return std::nullopt;
+    }
+
+    const auto preset = getPreset(slot - 1u);
+    if (preset.hash == hash && matches(preset)) {
+      return preset;
+    }
+  }
+
+  return std::nullopt;
+}
+
+size_t PresetBank::getSlot(size_t slotIndex) const noexcept {
+  return juce::ByteOrder::littleEndianInt(data + headerSize +
+                                          slotIndex * slotSize);
+}
+
+void PresetBank::apply(const Preset& preset, juce::AudioProcessor& processor) {
+  processor.setStateInformation(preset.state.data(),
+                                static_cast<int>(preset.state.size()));
+}
+
+juce::uint32 PresetBank::hashName(std::string_view name) noexcept {
+  juce::uint32 hash = 2166136261u;
+  for (const auto character : name) {
+    hash ^= static_cast<juce::uint8>(character);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+juce::MemoryBlock PresetBank::createBankData(
+    const std::vector<NamedState>& presets) {
+  const auto records = presets.size();
+  const auto slots = static_cast<size_t>(
+      juce::nextPowerOfTwo(static_cast<int>(juce::jmax(1uz, 2u * records))));
+
+  juce::MemoryBlock bankData{
+      headerSize + slots * slotSize + records * recordSize, true};
+  auto* const bytes = static_cast<juce::uint8*>(bankData.getData());
+  std::ranges::copy(presetBankMagic, bytes);
+  writeUint16LittleEndian(formatVersion, bytes + 4);
+  writeUint32LittleEndian(static_cast<juce::uint32>(records), bytes + 8);
+  writeUint32LittleEndian(static_cast<juce::uint32>(slots), bytes + 12);
+
+  auto* const index = bytes + headerSize;
+  auto* const firstRecord = index + slots * slotSize;
+
+  for (const auto recordIndex : std::views::iota(0uz, records)) {
+    const auto& [name, state] = presets[recordIndex];
+    jassert(name.size() <= maxNameLength);
+
+    auto* const record = firstRecord + recordIndex * recordSize;
+    const auto hash = hashName(name);
+    std::memcpy(record, name.data(), juce::jmin(name.size(), maxNameLength));
+    writeUint32LittleEndian(hash, record + maxNameLength);
+    std::ranges::copy(state, record + maxNameLength + 4u);
+
+    auto slotIndex = hash & (slots - 1u);
+    while (juce::ByteOrder::littleEndianInt(index + slotIndex * slotSize) !=
+           0u) {
+      slotIndex = (slotIndex + 1u) & (slots - 1u);
+    }
+    writeUint32LittleEndian(static_cast<juce::uint32>(recordIndex + 1u),
+                            index + slotIndex * slotSize);
+  }
+
+  return bankData;
+}
+}  // namespace tremolo
@@ -0,0 +1,126 @@
+namespace tremolo {
+namespace {
+/** Owns the parameters the preset states are parsed into.
+ *
+ * Unlike PluginProcessor, it doesn't load the editor's assets or start any
+ * threads, so it is cheap to create on the builder's thread.
+ */
+class PresetParameterHost : public juce::AudioProcessor {
+public:
+  [[nodiscard]] Parameters& getParameterRefs() noexcept { return parameters; }
+
+  const juce::String getName() const override { return {}; }
+  void prepareToPlay(double, int) override {}
+  void releaseResources() override {}
+  void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override {}
+  using AudioProcessor::processBlock;
+  double getTailLengthSeconds() const override { return 0.0; }
+  bool acceptsMidi() const override { return false; }
+  bool producesMidi() const override { return false; }
+  juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+  bool hasEditor() const override { return false; }
+  int getNumPrograms() override { return 1; }
+  int getCurrentProgram() override { return 0; }
+  void setCurrentProgram(int) override {}
+  const juce::String getProgramName(int) override { return {}; }
+  void changeProgramName(int, const juce::String&) override {}
+  void getStateInformation(juce::MemoryBlock&) override {}
+  void setStateInformation(const void*, int) override {}
+
+private:
+  Parameters parameters{*this};
+};
+}  // namespace
+
+PresetBankBuilder::PresetBankBuilder()
+    : threadPool{juce::ThreadPoolOptions{}
+                     .withThreadName("Tremolo preset bank builder")
+                     .withNumberOfThreads(1)} {}
+
+PresetBankBuilder::~PresetBankBuilder() {
+  [[maybe_unused]] const auto allJobsRemoved =
+      threadPool.removeAllJobs(true, 10'000);
+  jassert(allJobsRemoved);
+  cancelPendingUpdate();
+}
+
+void PresetBankBuilder::build(juce::File stateDirectory,
+                              juce::File bankFile,
+                              OnBuilt onBuilt) {
+  threadPool.addJob([this, directory = std::move(stateDirectory),
+                     file = std::move(bankFile),
+                     onBankBuilt = std::move(onBuilt)]() mutable {
+    auto result = buildBank(directory, file);
+
+    {
+      const juce::ScopedLock lock{builtBanksLock};
+      builtBanks.push_back({std::move(result), std::move(onBankBuilt)});
+    }
+
+    triggerAsyncUpdate();
+  });
+}
+
+juce::Result PresetBankBuilder::buildBank(const juce::File& stateDirectory,
+                                          const juce::File& bankFile) {
+  if (!stateDirectory.isDirectory()) {
+    return juce::Result::fail(stateDirectory.getFullPathName() +
+                              " is not a directory");
+  }
+
+  auto stateFiles =
+      stateDirectory.findChildFiles(juce::File::findFiles, false, "*.json");
+  stateFiles.sort();
+
+  // parse the states into the same parameters the plugin has
+  PresetParameterHost parameterHost;
+  auto& parameters = parameterHost.getParameterRefs();
+  std::vector<PresetBank::NamedState> presets;
+
+  for (const auto& stateFile : stateFiles) {
+    auto name = stateFile.getFileNameWithoutExtension().toStdString();
+
+    if (name.size() > PresetBank::maxNameLength ||
+        std::ranges::find(presets, name, &PresetBank::NamedState::name) !=
+            presets.end()) {
+      DBG("Skipping preset with invalid name: " + stateFile.getFullPathName());
+      continue;
+    }
+
+    juce::FileInputStream input{stateFile};
+    const auto result = input.openedOk()
+                            ? JsonSerializer::deserialize(input, parameters)
+                            : input.getStatus();
+
+    if (result.failed()) {
+      DBG("Skipping " + stateFile.getFullPathName() + ": " +
+          result.getErrorMessage());
+      continue;
+    }
+
+    presets.push_back(
+        {std::move(name), BinarySerializer::serialize(parameters)});
+  }
+
+  const auto bankData = PresetBank::createBankData(presets);
+
+  if (!bankFile.replaceWithData(bankData.getData(), bankData.getSize())) {
+    return juce::Result::fail("failed to write " + bankFile.getFullPathName());
+  }
+
+  return juce::Result::ok();
+}
+
+void PresetBankBuilder::handleAsyncUpdate() {
+  std::vector<BuiltBank> banksToDeliver;
+
+  {
+    const juce::ScopedLock lock{builtBanksLock};
+    std::swap(banksToDeliver, builtBanks);
+  }
+
+  for (auto& [result, onBuilt] : banksToDeliver) {
+    onBuilt(std::move(result));
+  }
+}
+}  // namespace tremolo
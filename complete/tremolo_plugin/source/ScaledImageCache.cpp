@@ -0,0 +1,70 @@
+namespace tremolo {
+juce::Image ScaledImageCache::getScaledImage(const juce::Image& source,
+                                             int widthPixels,
+                                             int heightPixels) {
+  const auto entry = std::ranges::find_if(entries, [&](const Entry& e) {
+    return e.source == source && e.widthPixels == widthPixels &&
+           e.heightPixels == heightPixels;
+  });
+
+  if (entry != entries.end()) {
+    // invalid while scaling is in progress
+    return entry->scaled;
+  }
+
+  evictOldestCopyIfFull(source);
+  entries.push_back({.source = source,
+                     .widthPixels = widthPixels,
+                     .heightPixels = heightPixels,
+                     .scaled = {}});
+
+  backgroundRenderer.render(
+      [source, widthPixels, heightPixels] {
+        return scale(source, widthPixels, heightPixels);
+      },
+      [this, source, widthPixels, heightPixels](juce::Image scaled) {
+        const auto pending = std::ranges::find_if(entries, [&](const Entry& e) {
+          return e.source == source && e.widthPixels == widthPixels &&
+                 e.heightPixels == heightPixels;
+        });
+
+        if (pending == entries.end()) {
+          // evicted in the meantime
+          return;
+        }
+
+        // native images blit faster in native graphics contexts
+        pending->scaled = juce::NativeImageType{}.convert(scaled);
+        sendChangeMessage();
+      });
+
+  return {};
+}
+
+juce::Image ScaledImageCache::scale(const juce::Image& source,
+                                    int widthPixels,
+                                    int heightPixels) {
+  juce::Image scaled{juce::Image::ARGB, juce::jmax(1, widthPixels),
+                     juce::jmax(1, heightPixels), true,
+                     juce::SoftwareImageType{}};
+
+  juce::Graphics g{scaled};
+  g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+  g.drawImage(source, scaled.getBounds().toFloat());
+
+  return scaled;
+}
+
+void ScaledImageCache::evictOldestCopyIfFull(const juce::Image& source) {
+  const auto copies = std::ranges::count_if(
+      entries, [&source](const Entry& e) { return e.source == source; });
+
+  if (copies < maxScaledCopiesPerImage) {
+    return;
+  }
+
+  // entries are appended, so the first match is the oldest one
+  entries.erase(std::ranges::find_if(
+      entries, [&source](const Entry& e) { return e.source == source; }));
+}
+}  // namespace tremolo
@@ -0,0 +1,59 @@
+namespace tremolo {
+namespace {
+juce::Image loadImage(const void* data, int sizeInBytes) {
+  // software images can be safely read on the background thread when
+  // ScaledImageCache scales them
+  return juce::SoftwareImageType{}.convert(juce::ImageFileFormat::loadFrom(
+      data, static_cast<size_t>(sizeInBytes)));
+}
+}  // namespace
+
+SharedResources::SharedResources()
+    : backgroundThreadPool{juce::ThreadPoolOptions{}
+                               .withThreadName("Tremolo background worker")
+                               .withNumberOfThreads(1)} {
+  backgroundThreadPool.addJob([this] { decodeImages(); });
+}
+
+juce::Image SharedResources::getBackgroundImage() const {
+  if (!imagesDecoded.load(std::memory_order_acquire)) {
+    return {};
+  }
+  return background;
+}
+
+juce::Image SharedResources::getLogoImage() const {
+  if (!imagesDecoded.load(std::memory_order_acquire)) {
+    return {};
+  }
+  return logo;
+}
+
+bool SharedResources::waitForImages(int timeoutMilliseconds) const {
+  return imagesDecodedEvent.wait(timeoutMilliseconds);
+}
+
+CustomLookAndFeel& SharedResources::getLookAndFeel() {
+  if (lookAndFeel == nullptr) {
+    lookAndFeel = std::make_unique<CustomLookAndFeel>();
+  }
+  return *lookAndFeel;
+}
+
+ScaledImageCache& SharedResources::getScaledImageCache() noexcept {
+  return scaledImageCache;
+}
+
+juce::ThreadPool& SharedResources::getBackgroundThreadPool() noexcept {
+  return backgroundThreadPool;
+}
+
+void SharedResources::decodeImages() {
+  background = loadImage(assets::Background_png, assets::Background_pngSize);
+  logo = loadImage(assets::Logo_png, assets::Logo_pngSize);
+
+  imagesDecoded.store(true, std::memory_order_release);
+  imagesDecodedEvent.signal();
+  sendChangeMessage();
+}
+}  // namespace tremolo
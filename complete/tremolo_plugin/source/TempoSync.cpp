@@ -0,0 +1,37 @@
+namespace tremolo {
+juce::StringArray TempoSync::getChoices() {
+  juce::StringArray choices{"Off"};
+  for (const auto& division : divisions) {
+    choices.add(division.name);
+  }
+  return choices;
+}
+
+TempoSync::LfoState TempoSync::getLfoState(
+    int choiceIndex,
+    const juce::AudioPlayHead::PositionInfo& position) noexcept {
+  jassert(0 < choiceIndex &&
+          static_cast<size_t>(choiceIndex) <= divisions.size());
+
+  const auto quarterNotes =
+      divisions[static_cast<size_t>(choiceIndex - 1)].quarterNotes;
+  const auto bpm = position.getBpm().orFallback(fallbackBpm);
+
+  LfoState state{
+      .frequencyHz = static_cast<float>(bpm / 60.0 / quarterNotes),
+      .phase = std::nullopt,
+  };
+
+  if (const auto ppq = position.getPpqPosition();
+      ppq.hasValue() && position.getIsPlaying()) {
+    const auto periods = *ppq / quarterNotes;
+    // floor() keeps the phase in [0, 1) for negative positions, e.g.,
+    // during a pre-roll
+    const auto phase = static_cast<float>(periods - std::floor(periods));
+    // the cast may round a phase just below 1 up to 1
+    state.phase = phase < 1.f ? phase : 0.f;
+  }
+
+  return state;
+}
+}  // namespace tremolo
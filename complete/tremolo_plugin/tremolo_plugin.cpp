@@ -1,8 +1,19 @@
 #include "tremolo_plugin.h"
 #include <TremoloPluginAssets.h>
+#include "source/BackgroundRenderer.cpp"
+#include "source/BinarySerializer.cpp"
 #include "source/LfoVisualizer.cpp"
+#include "source/LfoWavetables.cpp"
+#include "source/CustomLfoShape.cpp"
+#include "source/CustomLfoShapeEditor.cpp"
 #include "source/CustomLookAndFeel.cpp"
 #include "source/JsonSerializer.cpp"
 #include "source/Parameters.cpp"
 #include "source/PluginEditor.cpp"
 #include "source/PluginProcessor.cpp"
+#include "source/PrescaledImageComponent.cpp"
+#include "source/PresetBank.cpp"
+#include "source/PresetBankBuilder.cpp"
+#include "source/ScaledImageCache.cpp"
+#include "source/SharedResources.cpp"
+#include "source/TempoSync.cpp"
@@ -33,18 +33,47 @@ END_JUCE_MODULE_DECLARATION
 #include <ranges>
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include <deque>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 #include "include/Tremolo/detail/StridedQueue.h"
+#include "include/Tremolo/detail/LayerCache.h"
+#include "include/Tremolo/detail/CommandQueue.h"
+#include "include/Tremolo/detail/RcuPointer.h"
+#include "include/Tremolo/detail/LatestValue.h"
+#include "include/Tremolo/detail/ChannelBatch.h"
 
 #include "include/Tremolo/Parameters.h"
+#include "include/Tremolo/BackgroundRenderer.h"
 #include "include/Tremolo/CustomLookAndFeel.h"
+#include "include/Tremolo/ScaledImageCache.h"
+#include "include/Tremolo/PrescaledImageComponent.h"
+#include "include/Tremolo/SharedResources.h"
+#include "include/Tremolo/LfoWavetables.h"
+#include "include/Tremolo/CustomLfoShape.h"
 #include "include/Tremolo/JsonSerializer.h"
+#include "include/Tremolo/BinarySerializer.h"
+#include "include/Tremolo/PresetBank.h"
 #include "include/Tremolo/LfoVisualizer.h"
 #include "include/Tremolo/SampleFifo.h"
+#include "include/Tremolo/LinearRamp.h"
+#include "include/Tremolo/TempoSync.h"
+#include "include/Tremolo/WavetableLfo.h"
+#include "include/Tremolo/LinkwitzRileyCrossover.h"
+#include "include/Tremolo/EnvelopeFollower.h"
 #include "include/Tremolo/Tremolo.h"
 #include "include/Tremolo/BypassTransitionSmoother.h"
 #include "include/Tremolo/PluginProcessor.h"
+#include "include/Tremolo/PresetBankBuilder.h"
 #include "include/Tremolo/MessageOnClick.h"
+#include "include/Tremolo/CustomLfoShapeEditor.h"
 #include "include/Tremolo/PluginEditor.h"